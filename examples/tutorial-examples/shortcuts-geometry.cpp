@@ -365,6 +365,28 @@ int main( int /* argc */, char** /* argv */ )
     ++nb; nbok += ok3 ? 1 : 0;
   }
   trace.endBlock();
+
+  trace.beginBlock ( "Load vol file -> build main digital surface -> geodesic distances by heat method -> save OBJ with colored distances." );
+  {
+    auto params     = SH3::defaultParameters() | SHG3::defaultParameters();
+    //! [dgtal_shortcuts_ssec2_2_13s]
+    auto al_capone  = SH3::makeBinaryImage( examplesPath + "samples/Al.100.vol", params );
+    auto K          = SH3::getKSpace( al_capone );
+    auto surface    = SH3::makeLightDigitalSurface( al_capone, K, params );
+    auto surfels    = SH3::getSurfelRange( surface, params );
+    auto heat       = SHG3::makeGeodesicsInHeat( surface, surfels, params );
+    auto distances  = SHG3::getGeodesicDistances( heat, surfels,
+                                                  SH3::SurfelRange( 1, surfels[ 0 ] ), params );
+    auto max_d      = *std::max_element( distances.cbegin(), distances.cend() );
+    auto cmap       = SH3::getColorMap( 0.0, max_d, params );
+    auto colors     = SH3::Colors( surfels.size() );
+    std::transform( distances.cbegin(), distances.cend(), colors.begin(), cmap );
+    bool ok         = SH3::saveOBJ( surface, SH3::RealVectors(), colors,
+                                    "al-geodesic-distances.obj" );
+    //! [dgtal_shortcuts_ssec2_2_13s]
+    ++nb; nbok += ok ? 1 : 0;
+  }
+  trace.endBlock();
   
 #endif // defined(WITH_EIGEN)
   
@@ -76,7 +76,8 @@ It is a backport of <a
 href="https://gforge.liris.cnrs.fr/projects/imagene">ImaGene</a>.
 
 @tparam TInteger any model of integer (CInteger), like \c int, \c long int,
-\c int64_t, \c BigInteger (when GMP is installed).
+\c int64_t, \c int128_t (when the compiler provides it), \c BigInteger
+(when GMP is installed).
    
    */
   template <typename TInteger>
@@ -218,10 +219,9 @@ href="https://gforge.liris.cnrs.fr/projects/imagene">ImaGene</a>.
     /**
        Computes the euclidean division of a/b, returning quotient and
        remainder. May be faster than computing separately quotient and
-       remainder, depending on the integral type in use.
-
-       @todo Specialize it for GMP as mpz_fdiv_qr (q.get_mpz_t(),
-       r.get_mpz_t(), a.get_mpz_t(), b.get_mpz_t());
+       remainder, depending on the integral type in use (big integers
+       use mpz_tdiv_qr, 128-bit integers use 64-bit divisions whenever
+       the operands fit).
 
        @param q (returns) the quotient of a/b.
        @param r (returns) the remainder of a/b.
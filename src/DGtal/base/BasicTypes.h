@@ -44,6 +44,7 @@
 // Inclusions
 #include <cstdlib>
 #include <iostream>
+#include <string>
 #include <boost/cstdint.hpp>
 
 #ifdef WITH_GMP
@@ -79,6 +80,62 @@ namespace DGtal
   typedef mpz_class BigInteger;
 #endif
 
+#if defined(__SIZEOF_INT128__)
+  /// Defined when the compiler provides 128-bit integers (this is
+  /// not a build option).
+  #define DGTAL_HAS_INT128
+  ///signed 128-bit integer (compiler extension).
+  __extension__ typedef __int128 int128_t;
+  ///unsigned 128-bit integer (compiler extension).
+  __extension__ typedef unsigned __int128 uint128_t;
+
+  /**
+   * Writes an unsigned 128-bit integer in decimal notation (the
+   * standard streams have no such overload).
+   *
+   * @note Since uint128_t is a builtin type, argument-dependent
+   * lookup does not find this operator: outside namespace DGtal, it
+   * must be made visible, e.g. with <tt>using DGtal::operator<<;</tt>
+   * or <tt>using namespace DGtal;</tt>.
+   *
+   * @param out the output stream where the number is written.
+   * @param x any unsigned 128-bit integer.
+   * @return the output stream after the writing.
+   */
+  inline
+  std::ostream & operator<<( std::ostream & out, uint128_t x )
+  {
+    char buffer[ 40 ];
+    char * p = buffer + 40;
+    do
+      {
+        *--p = static_cast<char>( '0' + static_cast<int>( x % 10 ) );
+        x /= 10;
+      }
+    while ( x != 0 );
+    return out << std::string( p, buffer + 40 );
+  }
+
+  /**
+   * Writes a signed 128-bit integer in decimal notation (the
+   * standard streams have no such overload).
+   *
+   * @note As for uint128_t, this operator is not found by
+   * argument-dependent lookup outside namespace DGtal.
+   *
+   * @param out the output stream where the number is written.
+   * @param x any signed 128-bit integer.
+   * @return the output stream after the writing.
+   */
+  inline
+  std::ostream & operator<<( std::ostream & out, int128_t x )
+  {
+    if ( x >= 0 ) return out << static_cast<uint128_t>( x );
+    // -(x+1)+1 avoids the overflow of -x for the minimal value.
+    return out << '-' << ( static_cast<uint128_t>( -( x + 1 ) ) + 1 );
+  }
+#endif
+
 } // namespace DGtal
 
 
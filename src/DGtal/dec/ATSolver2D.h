@@ -49,6 +49,7 @@
 #include "DGtal/dec/DiscreteExteriorCalculus.h"
 #include "DGtal/dec/DiscreteExteriorCalculusSolver.h"
 #include "DGtal/dec/DECHelpers.h"
+#include "DGtal/dec/MatrixFreeLinearOperator.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -138,6 +139,10 @@ namespace DGtal
     typedef EigenLinearAlgebraBackend::SolverSimplicialLDLT LinearAlgebraSolver;
     typedef DiscreteExteriorCalculusSolver<Calculus, LinearAlgebraSolver, 2, PRIMAL, 2, PRIMAL> SolverU2;
     typedef DiscreteExteriorCalculusSolver<Calculus, LinearAlgebraSolver, 0, PRIMAL, 0, PRIMAL> SolverV0;
+    typedef MatrixFreeLinearOperator<Calculus, 2, PRIMAL, 2, PRIMAL> MatrixFreeOperatorU2;
+    typedef MatrixFreeLinearOperator<Calculus, 0, PRIMAL, 0, PRIMAL> MatrixFreeOperatorV0;
+    typedef DiscreteExteriorCalculusSolver<Calculus, typename MatrixFreeOperatorU2::SolverConjugateGradient, 2, PRIMAL, 2, PRIMAL> MatrixFreeSolverU2;
+    typedef DiscreteExteriorCalculusSolver<Calculus, typename MatrixFreeOperatorV0::SolverConjugateGradient, 0, PRIMAL, 0, PRIMAL> MatrixFreeSolverV0;
 
   protected:
     /// A smart (or not) pointer to a calculus object.
@@ -169,6 +174,15 @@ namespace DGtal
     PrimalForm0           former_v0;
     /// The primal 0-form lambda/(4epsilon) (stored for performance)
     PrimalForm0           l_1_over_4e;
+    /// The matrix-free operator for u, \f$ \alpha Id + AD_2^T
+    /// \mathrm{diag}(v^2) AD_2 \f$, built at the first matrix-free
+    /// step after setUp. Only its weights change between steps.
+    MatrixFreeOperatorU2  mf_ope_u2;
+    /// The matrix-free operator for v, \f$ \lambda/(4\epsilon) Id +
+    /// \lambda\epsilon D_0^T D_0 + M_{01}^T \mathrm{diag}(|AD_2 u|^2)
+    /// M_{01} \f$, built at the first matrix-free step. Only its
+    /// factors and weights change between steps.
+    MatrixFreeOperatorV0  mf_ope_v0;
 
   public:
     // The map Surfel -> Index that gives the index of the surfel in 2-forms.
@@ -187,6 +201,12 @@ namespace DGtal
     double                epsilon;
     /// Indicates whether to normalize U (unit norm) at each iteration or not.
     bool                  normalize_u2;
+    /// When 'true', the linear systems of each alternate step are
+    /// solved by a matrix-free conjugate gradient (relative residual
+    /// 1e-8, started from the previous u and v), which avoids sparse
+    /// matrix products and factorizations. Default is 'false' (sparse
+    /// Cholesky factorization).
+    bool                  matrix_free;
     /// Tells the verbose level.
     int                   verbose;
 
@@ -205,7 +225,8 @@ namespace DGtal
         M01( *ptrCalculus ), M12( *ptrCalculus ), primal_AD2( *ptrCalculus ),
         alpha_Id2( *ptrCalculus ), l_1_over_4e_Id0( *ptrCalculus ),
         g2(), alpha_g2(), u2(), v0( *ptrCalculus ), former_v0( *ptrCalculus ),
-        l_1_over_4e( *ptrCalculus ), verbose( aVerbose )
+        l_1_over_4e( *ptrCalculus ), mf_ope_u2( *ptrCalculus ), mf_ope_v0( *ptrCalculus ),
+        matrix_free( false ), verbose( aVerbose )
     {
       if ( verbose >= 2 )
 	trace.info() << "[ATSolver::ATSolver] " << *ptrCalculus << std::endl;
@@ -449,6 +470,7 @@ namespace DGtal
       alpha_Id2 = alpha * ptrCalculus->template identity<2, PRIMAL>();
       for ( Dimension k = 0; k < N; ++k )
         alpha_g2[ k ] = alpha * g2[ k ];
+      mf_ope_u2.clear();
     }
 
     /// Initializes the alpha and lambda parameters of AT, with
@@ -479,6 +501,7 @@ namespace DGtal
             alpha_g2[ k ].myContainer( index ) *= w;
         }
       alpha_Id2 = alpha * diagonal( w_form );
+      mf_ope_u2.clear();
     }
 
     /// Initializes the alpha and lambda parameters of AT, with
@@ -518,6 +541,7 @@ namespace DGtal
 	    alpha_g2[ k ].myContainer( idx ) *= w;
 	}
       alpha_Id2 = alpha * diagonal( w_form );
+      mf_ope_u2.clear();
     }
 
     /// Initializes the epsilon parameter of AT and precomputes the assaociated forms and operators.
@@ -549,19 +573,24 @@ namespace DGtal
       if ( verbose >= 1 ) trace.beginBlock("Solving for u as a 2-form");
       PrimalForm1 v1_squared = M01*v0;
       v1_squared.myContainer.array() = v1_squared.myContainer.array().square();
-      const PrimalIdentity2 ope_u2 = alpha_Id2
-        + primal_AD2.transpose() * dec_helper::diagonal( v1_squared ) * primal_AD2;
-
-      if ( verbose >= 2 ) trace.info() << "Prefactoring matrix U associated to u" << std::endl;
-      SolverU2 solver_u2;
-      solver_u2.compute( ope_u2 );
-      for ( Dimension d = 0; d < u2.size(); ++d )
+      if ( matrix_free )
+        solve_ok = solveU2MatrixFree( v1_squared ) && solve_ok;
+      else
         {
-          if ( verbose >= 2 ) trace.info() << "Solving U u[" << d << "] = a g[" << d << "]" << std::endl;
-          u2[ d ] = solver_u2.solve( alpha_g2[ d ] );
-          if ( verbose >= 2 ) trace.info() << "  => " << ( solver_u2.isValid() ? "OK" : "ERROR" )
-                                           << " " << solver_u2.myLinearAlgebraSolver.info() << std::endl;
-          solve_ok = solve_ok && solver_u2.isValid();
+          const PrimalIdentity2 ope_u2 = alpha_Id2
+            + primal_AD2.transpose() * dec_helper::diagonal( v1_squared ) * primal_AD2;
+
+          if ( verbose >= 2 ) trace.info() << "Prefactoring matrix U associated to u" << std::endl;
+          SolverU2 solver_u2;
+          solver_u2.compute( ope_u2 );
+          for ( Dimension d = 0; d < u2.size(); ++d )
+            {
+              if ( verbose >= 2 ) trace.info() << "Solving U u[" << d << "] = a g[" << d << "]" << std::endl;
+              u2[ d ] = solver_u2.solve( alpha_g2[ d ] );
+              if ( verbose >= 2 ) trace.info() << "  => " << ( solver_u2.isValid() ? "OK" : "ERROR" )
+                                               << " " << solver_u2.myLinearAlgebraSolver.info() << std::endl;
+              solve_ok = solve_ok && solver_u2.isValid();
+            }
         }
       if ( normalize_u2 ) normalizeU2();
       if ( verbose >= 1 ) trace.endBlock();
@@ -570,19 +599,24 @@ namespace DGtal
       PrimalForm1 squared_norm_d_u2 = PrimalForm1::zeros(*ptrCalculus);
       for ( Dimension d = 0; d < u2.size(); ++d )
         squared_norm_d_u2.myContainer.array() += (primal_AD2 * u2[ d ] ).myContainer.array().square();
-      trace.info() << "build metric u2" << std::endl;
-      const PrimalIdentity0 ope_v0 = l_1_over_4e_Id0
-        + (lambda * epsilon) * primal_D0.transpose() * primal_D0
-	+ M01.transpose() * dec_helper::diagonal( squared_norm_d_u2 ) * M01;
-
-      if ( verbose >= 2 ) trace.info() << "Prefactoring matrix V associated to v" << std::endl;
-      SolverV0 solver_v0;
-      solver_v0.compute( ope_v0 );
-      if ( verbose >= 2 ) trace.info() << "Solving V v = l/4e * 1" << std::endl;
-      v0 = solver_v0.solve( l_1_over_4e );
-      if ( verbose >= 2 ) trace.info() << "  => " << ( solver_v0.isValid() ? "OK" : "ERROR" )
-                                       << " " << solver_v0.myLinearAlgebraSolver.info() << std::endl;
-      solve_ok = solve_ok && solver_v0.isValid();
+      if ( matrix_free )
+        solve_ok = solveV0MatrixFree( squared_norm_d_u2 ) && solve_ok;
+      else
+        {
+          trace.info() << "build metric u2" << std::endl;
+          const PrimalIdentity0 ope_v0 = l_1_over_4e_Id0
+            + (lambda * epsilon) * primal_D0.transpose() * primal_D0
+            + M01.transpose() * dec_helper::diagonal( squared_norm_d_u2 ) * M01;
+
+          if ( verbose >= 2 ) trace.info() << "Prefactoring matrix V associated to v" << std::endl;
+          SolverV0 solver_v0;
+          solver_v0.compute( ope_v0 );
+          if ( verbose >= 2 ) trace.info() << "Solving V v = l/4e * 1" << std::endl;
+          v0 = solver_v0.solve( l_1_over_4e );
+          if ( verbose >= 2 ) trace.info() << "  => " << ( solver_v0.isValid() ? "OK" : "ERROR" )
+                                           << " " << solver_v0.myLinearAlgebraSolver.info() << std::endl;
+          solve_ok = solve_ok && solver_v0.isValid();
+        }
       if ( verbose >= 1 ) trace.endBlock();
       return solve_ok;
     }
@@ -990,6 +1024,67 @@ namespace DGtal
       if ( verbose >= 1 ) trace.endBlock();
     }
 
+    /// Solves for u with the matrix-free conjugate gradient,
+    /// starting from the current u (see \ref matrix_free).
+    ///
+    /// @param v1_squared the primal 1-form \f$ (M_{01} v)^2 \f$.
+    /// @return true if the conjugate gradient converged.
+    bool solveU2MatrixFree( const PrimalForm1& v1_squared )
+    {
+      bool solve_ok = true;
+      if ( mf_ope_u2.nbTerms() == 0 )
+        {
+          mf_ope_u2.addOperator( alpha_Id2 );
+          mf_ope_u2.addNormalComposition( primal_AD2, v1_squared );
+        }
+      else
+        mf_ope_u2.setWeights( 1, v1_squared );
+      MatrixFreeSolverU2 solver_u2;
+      solver_u2.myLinearAlgebraSolver.setTolerance( 1e-8 );
+      solver_u2.compute( mf_ope_u2 );
+      for ( Dimension d = 0; d < u2.size(); ++d )
+        {
+          u2[ d ].myContainer = solver_u2.myLinearAlgebraSolver
+            .solveWithGuess( alpha_g2[ d ].myContainer, u2[ d ].myContainer );
+          if ( verbose >= 2 ) trace.info() << "Solving U u[" << d << "] = a g[" << d << "] => "
+                                           << solver_u2.myLinearAlgebraSolver.iterations()
+                                           << " CG iterations" << std::endl;
+          solve_ok = solve_ok && solver_u2.isValid();
+        }
+      return solve_ok;
+    }
+
+    /// Solves for v with the matrix-free conjugate gradient,
+    /// starting from the current v (see \ref matrix_free).
+    ///
+    /// @param squared_norm_d_u2 the primal 1-form \f$ \sum_k (AD_2 u_k)^2 \f$.
+    /// @return true if the conjugate gradient converged.
+    bool solveV0MatrixFree( const PrimalForm1& squared_norm_d_u2 )
+    {
+      // l_1_over_4e_Id0 is the identity scaled by lambda/(4 epsilon).
+      if ( mf_ope_v0.nbTerms() == 0 )
+        {
+          mf_ope_v0.addIdentity( lambda / 4. / epsilon );
+          mf_ope_v0.addNormalComposition( primal_D0, lambda * epsilon );
+          mf_ope_v0.addNormalComposition( M01, squared_norm_d_u2 );
+        }
+      else
+        {
+          mf_ope_v0.setScale( 0, lambda / 4. / epsilon );
+          mf_ope_v0.setScale( 1, lambda * epsilon );
+          mf_ope_v0.setWeights( 2, squared_norm_d_u2 );
+        }
+      MatrixFreeSolverV0 solver_v0;
+      solver_v0.myLinearAlgebraSolver.setTolerance( 1e-8 );
+      solver_v0.compute( mf_ope_v0 );
+      v0.myContainer = solver_v0.myLinearAlgebraSolver
+        .solveWithGuess( l_1_over_4e.myContainer, v0.myContainer );
+      if ( verbose >= 2 ) trace.info() << "Solving V v = l/4e * 1 => "
+                                       << solver_v0.myLinearAlgebraSolver.iterations()
+                                       << " CG iterations" << std::endl;
+      return solver_v0.isValid();
+    }
+
     /// @}
     
     // ------------------------- Internals ------------------------------------
@@ -44,6 +44,7 @@
 #include <vector>
 #include <map>
 #include <list>
+#include <mutex>
 #include <boost/array.hpp>
 #include <boost/unordered_map.hpp>
 #include "DGtal/kernel/SpaceND.h"
@@ -88,6 +89,17 @@ namespace DGtal
    * This is used to describe the space on which the dec is build and to compute various operators.
    * Once operators or kforms are created, this structure should not be modified.
    *
+   * Operators are assembled row by row, rows being computed in
+   * parallel when OpenMP is available. When enabled with
+   * setOperatorMemoization(), derivative, antiderivative, hodge and
+   * laplace operators are memoized: they are computed at their first
+   * call and then copied from the cache, until the cells or their
+   * sizes are modified (insertSCell, eraseCell, resetSizes,
+   * updateIndexes or non-const iteration over the properties) or
+   * clearMemoizedOperators() is called. The cache is guarded by a
+   * mutex, so that const methods returning operators may be called
+   * concurrently on the same calculus.
+   *
    * @tparam dimEmbedded dimension of emmbedded manifold.
    * @tparam dimAmbient dimension of ambient manifold.
    * @tparam TLinearAlgebraBackend linear algebra backend used (i.e. EigenSparseLinearAlgebraBackend).
@@ -269,6 +281,7 @@ namespace DGtal
 
     /**
      * Begin iterator.
+     * Clears memoized operators since properties may be modified.
      */
     Iterator begin();
 
@@ -395,6 +408,8 @@ namespace DGtal
 
     /**
      * Laplace operator from duality 0-forms to duality 0-forms.
+     * Computed as antiderivative<1, duality>() * derivative<0, duality>()
+     * and memoized.
      * @return Laplace operator.
      */
     template <Duality duality>
@@ -537,6 +552,30 @@ namespace DGtal
     void
     resetSizes();
 
+    /**
+     * Clear memoized derivative, antiderivative, hodge and laplace
+     * operators, e.g. to free memory. They are recomputed on demand.
+     */
+    void
+    clearMemoizedOperators();
+
+    /**
+     * Enable or disable the memoization of derivative, antiderivative,
+     * hodge and laplace operators (disabled by default). Memoized
+     * operators are kept until the calculus is modified or
+     * clearMemoizedOperators() is called. Disabling the memoization
+     * clears them.
+     * @param enabled 'true' to memoize operators.
+     */
+    void
+    setOperatorMemoization(const bool enabled);
+
+    /**
+     * @return 'true' if operators are memoized.
+     */
+    bool
+    isOperatorMemoizationEnabled() const;
+
     /**
      * Checks the validity/consistency of the object.
      * @return 'true' if the object is valid, 'false' otherwise.
@@ -578,6 +617,61 @@ namespace DGtal
      */
     bool myIndexesNeedUpdate;
 
+    /**
+     * Kinds of memoized operators.
+     */
+    enum MemoizedOperator { MEMO_DERIVATIVE, MEMO_ANTIDERIVATIVE, MEMO_HODGE, MEMO_LAPLACE };
+
+    /**
+     * Memoized operator key: (kind of operator, order, duality) of the
+     * input k-forms.
+     */
+    typedef boost::array<int, 3> MemoKey;
+
+    /**
+     * Memoized operator matrices and the mutex guarding them. Copies
+     * get their own copy of the matrices and their own mutex.
+     */
+    struct MemoizedOperators
+    {
+        std::map<MemoKey, SparseMatrix> matrices; ///< matrices by key.
+        mutable std::mutex mutex; ///< guards matrices.
+
+        MemoizedOperators() {}
+        MemoizedOperators(const MemoizedOperators& other)
+        {
+            std::lock_guard<std::mutex> lock(other.mutex);
+            matrices = other.matrices;
+        }
+        MemoizedOperators& operator=(const MemoizedOperators& other)
+        {
+            if (this == &other) return *this;
+            std::map<MemoKey, SparseMatrix> copy;
+            {
+                std::lock_guard<std::mutex> lock(other.mutex);
+                copy = other.matrices;
+            }
+            std::lock_guard<std::mutex> lock(mutex);
+            matrices.swap(copy);
+            return *this;
+        }
+        void clear()
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            matrices.clear();
+        }
+    };
+
+    /**
+     * Operator memoization flag.
+     */
+    bool myOperatorMemoization;
+
+    /**
+     * Memoized operators.
+     */
+    mutable MemoizedOperators myMemoizedOperators;
+
 
     // ------------------------- Hidden services ------------------------------
   protected:
@@ -591,6 +685,54 @@ namespace DGtal
     void
     updateCachedOperators();
 
+    /**
+     * Entry of a row of an assembled operator.
+     */
+    struct RowEntry
+    {
+        Index column; ///< column of the entry.
+        Scalar value; ///< value of the entry.
+        Dimension matrix; ///< index of the matrix holding the entry (direction for flat and sharp operators).
+    };
+
+    /**
+     * Assemble @a nb_matrices sparse matrices of size @a nb_rows x @a nb_cols row by row.
+     * Rows are computed in parallel (with OpenMP) into slots of @a max_row_size entries,
+     * then gathered in row order, so that the matrices do not depend on the number of threads.
+     * @tparam TRowFunction type of functor (Index row, RowEntry* entries) -> number of entries written.
+     * @param nb_rows number of rows.
+     * @param nb_cols number of columns.
+     * @param max_row_size maximal number of entries per row.
+     * @param row_function functor computing the entries of one row.
+     * @param nb_matrices number of assembled matrices.
+     * @return the assembled matrices.
+     */
+    template <typename TRowFunction>
+    std::vector<SparseMatrix>
+    assembleRows(const Index nb_rows, const Index nb_cols, const Index max_row_size,
+                 const TRowFunction& row_function, const Dimension nb_matrices = 1) const;
+
+    /**
+     * Find memoized operator matrix.
+     * @param kind kind of operator.
+     * @param order input order.
+     * @param duality input duality.
+     * @param[out] matrix copy of the memoized matrix, if found.
+     * @return 'true' if the operator is memoized.
+     */
+    bool
+    findMemoizedOperator(const MemoizedOperator kind, const Order order, const Duality duality, SparseMatrix& matrix) const;
+
+    /**
+     * Memoize operator matrix, if memoization is enabled.
+     * @param kind kind of operator.
+     * @param order input order.
+     * @param duality input duality.
+     * @param matrix operator matrix.
+     */
+    void
+    memoizeOperator(const MemoizedOperator kind, const Order order, const Duality duality, const SparseMatrix& matrix) const;
+
     /**
      * Update flat operator cache.
      * @tparam duality duality of updated flat operator.
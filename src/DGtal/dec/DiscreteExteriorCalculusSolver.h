@@ -51,6 +51,9 @@
 namespace DGtal
 {
 
+  template <typename TCalculus, Order order_in, Duality duality_in, Order order_out, Duality duality_out>
+  class MatrixFreeLinearOperator;
+
   /////////////////////////////////////////////////////////////////////////////
   // template class DiscreteExteriorCalculusSolver
   /**
@@ -79,6 +82,7 @@ namespace DGtal
     typedef TLinearAlgebraSolver LinearAlgebraSolver;
 
     typedef LinearOperator<Calculus, order_in, duality_in, order_out, duality_out> Operator;
+    typedef MatrixFreeLinearOperator<Calculus, order_in, duality_in, order_out, duality_out> MatrixFreeOperator;
     typedef KForm<Calculus, order_in, duality_in> SolutionKForm;
     typedef KForm<Calculus, order_out, duality_out> InputKForm;
 
@@ -112,6 +116,16 @@ namespace DGtal
      */
     DiscreteExteriorCalculusSolver& compute(const Operator& linear_operator);
 
+    /**
+     * Set problem operator without building its matrix. The linear
+     * algebra solver must be a matrix-free iterative solver, e.g.
+     * MatrixFreeOperator::SolverConjugateGradient. The operator is
+     * referenced, not copied: it must outlive calls to solve().
+     * @param linear_operator matrix-free linear operator.
+     * @return *this.
+     */
+    DiscreteExteriorCalculusSolver& compute(const MatrixFreeOperator& linear_operator);
+
     /**
      * Solve prefactorized / set problem input.
      * @param input_kform input k-form.
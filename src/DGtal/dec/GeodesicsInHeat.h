@@ -0,0 +1,341 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file GeodesicsInHeat.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module GeodesicsInHeat.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(GeodesicsInHeat_RECURSES)
+#error Recursive header files inclusion detected in GeodesicsInHeat.h
+#else // defined(GeodesicsInHeat_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define GeodesicsInHeat_RECURSES
+
+#if !defined GeodesicsInHeat_h
+/** Prevents repeated inclusion of headers. */
+#define GeodesicsInHeat_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <limits>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/math/linalg/EigenSupport.h"
+#include "DGtal/dec/DiscreteExteriorCalculus.h"
+#include "DGtal/dec/DiscreteExteriorCalculusSolver.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class GeodesicsInHeat
+  /**
+  * Description of template class 'GeodesicsInHeat' <p> \brief Aim:
+  * This class computes approximate geodesic distances on a
+  * two-dimensional digital space (a 2D grid or 2D digital surface)
+  * with the heat method of Crane, Weischedel and Wardetzky
+  * (Geodesics in Heat, ACM ToG, 2013). Distances are dual 0-forms,
+  * i.e. one value per 2-cell (per surfel for digital surfaces).
+  *
+  * For a set of sources, the heat method (1) diffuses a Dirac during
+  * a short time \a dt, by solving \f$ (Id + dt L) u = \delta \f$, (2)
+  * normalizes the gradient of \a u into a unit vector field \a X
+  * pointing away from the sources, and (3) solves the Poisson problem
+  * \f$ L \phi = \delta X \f$. Both linear systems only depend on the
+  * calculus, so they are factorized once at construction. Each
+  * distance computation then costs two back-substitutions and a few
+  * sparse matrix-vector products, and is thread-safe: several sets of
+  * sources may be processed concurrently (see computeBatch).
+  *
+  * @tparam TKSpace any model of CCellularGridSpaceND, e.g KhalimskySpaceND
+  *
+  * @tparam TLinearAlgebra any back-end for performing linear algebra,
+  * default is EigenLinearAlgebraBackend.
+  *
+  * \code
+  * // Typical use (with appropriate definitions for types and variables).
+  * typedef DiscreteExteriorCalculusFactory<EigenLinearAlgebraBackend> CalculusFactory;
+  * const auto calculus = CalculusFactory::createFromNSCells<2>( surfels.begin(), surfels.end() );
+  * GeodesicsInHeat< KSpace > heat( calculus, 1.0 );
+  * auto distances = heat.compute( { heat.index( surfels[ 0 ] ) } );
+  * \endcode
+  *
+  * @note Distances are given in grid units (the size of cells is 1).
+  * @see ShortcutsGeometry::makeGeodesicsInHeat
+  */
+  template < typename TKSpace,
+             typename TLinearAlgebra = EigenLinearAlgebraBackend >
+  class GeodesicsInHeat
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    typedef TKSpace                                              KSpace;
+    typedef TLinearAlgebra                                       LinearAlgebra;
+    typedef GeodesicsInHeat< KSpace, LinearAlgebra >             Self;
+
+    static const Dimension dimension = KSpace::dimension;
+
+    typedef typename KSpace::SCell                               SCell;
+    typedef DiscreteExteriorCalculus<2,dimension, LinearAlgebra> Calculus;
+    typedef typename Calculus::Index                             Index;
+    typedef typename Calculus::Scalar                            Scalar;
+    typedef typename Calculus::DualForm0                         DualForm0;
+    typedef typename Calculus::DualIdentity0                     DualIdentity0;
+    typedef typename KSpace::Space::RealVector                   RealVector;
+    typedef std::vector< Index >                                 Indices;
+
+    /// A pair of adjacent 2-cells, with the unit vectors pointing
+    /// from the center of each 2-cell to their common 1-cell.
+    struct DualEdge
+    {
+      Index      first;      ///< index of the first 2-cell
+      Index      second;     ///< index of the second 2-cell
+      RealVector first_dir;  ///< direction from the first 2-cell to the 1-cell
+      RealVector second_dir; ///< direction from the second 2-cell to the 1-cell
+    };
+
+    typedef EigenLinearAlgebraBackend::SolverSimplicialLDLT      LinearAlgebraSolver;
+    typedef DiscreteExteriorCalculusSolver<Calculus, LinearAlgebraSolver, 0, DUAL, 0, DUAL> Solver;
+
+    /// Prepares the service from a valid calculus: builds the
+    /// operators and factorizes the heat and Poisson systems.
+    ///
+    /// @param aCalculus any valid calculus with 2-cells (e.g. the surfels of a digital surface).
+    /// @param dt the diffusion time, in squared grid units (1 is a good choice).
+    /// @param aVerbose tells how the service displays computing information: 0 none, 1 more.
+    /// @see \ref DiscreteExteriorCalculusFactory for creating calculus objects.
+    GeodesicsInHeat( ConstAlias< Calculus > aCalculus, Scalar dt = 1.0, int aVerbose = 0 )
+      : ptrCalculus( aCalculus ), time_step( dt ), verbose( aVerbose )
+    {
+      init();
+    }
+
+    /**
+     * Default constructor.
+     */
+    GeodesicsInHeat() = delete;
+
+    /**
+     * Destructor.
+     */
+    ~GeodesicsInHeat() = default;
+
+    /// @return the number of 2-cells, i.e. the length of distance forms.
+    Index size() const
+    {
+      return ptrCalculus->kFormLength( 0, DUAL );
+    }
+
+    /// @param surfel any 2-cell of the calculus.
+    /// @return its index in dual 0-forms (e.g. distances).
+    Index index( const SCell& surfel ) const
+    {
+      return ptrCalculus->getCellIndex( ptrCalculus->myKSpace.unsigns( surfel ) );
+    }
+
+    /// @return the diffusion time.
+    Scalar timeStep() const
+    {
+      return time_step;
+    }
+
+    /// @return 'true' if both systems were successfully factorized.
+    bool isValid() const
+    {
+      return heat_solver.isValid() && poisson_solver.isValid();
+    }
+
+    /// @}
+
+    // ----------------------- Distance services ------------------------------
+  public:
+    /// @name Distance services
+    /// @{
+
+    /// Computes the geodesic distance to a set of sources. This
+    /// method does not modify the object and may be called
+    /// concurrently.
+    ///
+    /// The heat method gives distances up to a constant: they are
+    /// shifted so that their mean value over the sources is 0 (i.e. 0
+    /// at a single source). Since they are approximate, distances may
+    /// be slightly negative close to the sources.
+    ///
+    /// @param sources the indices of the source 2-cells (see index).
+    /// Indices outside [0,size()) are ignored with a warning.
+    /// @return the dual 0-form of distances to the closest source, or
+    /// the null form if there is no valid source.
+    DualForm0 compute( const Indices& sources ) const
+    {
+      DualForm0 delta( *ptrCalculus );
+      Index nb_ignored = 0;
+      for ( auto s : sources )
+        {
+          if ( 0 <= s && s < size() ) delta.myContainer( s ) = 1.0;
+          else nb_ignored++;
+        }
+      if ( nb_ignored != 0 )
+        trace.warning() << "[GeodesicsInHeat::compute] " << nb_ignored
+                        << " source indices out of [0," << size()
+                        << ") are ignored." << std::endl;
+      if ( nb_ignored == static_cast<Index>( sources.size() ) ) return delta;
+      // Diffuses heat from sources.
+      const DualForm0 u = heat_solver.solve( delta );
+      // Normalized vector field pointing away from sources, from the
+      // central differences of u across the edges of each 2-cell.
+      std::vector<RealVector> X( size(), RealVector::zero );
+      for ( const auto& e : dual_edges )
+        {
+          const Scalar du = 0.5 * ( u.myContainer( e.second ) - u.myContainer( e.first ) );
+          X[ e.first  ] += du * e.first_dir;
+          X[ e.second ] -= du * e.second_dir;
+        }
+      for ( auto& x : X )
+        {
+          const Scalar n = x.norm();
+          x = ( n > std::numeric_limits<Scalar>::min() ) ? x / -n : RealVector::zero;
+        }
+      // Integrated divergence of X, as the sum of its fluxes across
+      // the edges of each 2-cell.
+      DualForm0 minus_div( *ptrCalculus );
+      for ( const auto& e : dual_edges )
+        {
+          const Scalar flux = 0.5 * ( X[ e.first ].dot( e.first_dir )
+                                      - X[ e.second ].dot( e.second_dir ) );
+          minus_div.myContainer( e.first  ) -= flux;
+          minus_div.myContainer( e.second ) += flux;
+        }
+      // Solves for the function whose gradient is X.
+      DualForm0 phi = poisson_solver.solve( minus_div );
+      Scalar shift = 0.0;
+      Index  nb_sources = 0;
+      for ( Index i = 0; i < size(); ++i )
+        if ( delta.myContainer( i ) != 0.0 )
+          {
+            shift += phi.myContainer( i );
+            nb_sources++;
+          }
+      phi.myContainer.array() -= shift / nb_sources;
+      return phi;
+    }
+
+    /// Computes the geodesic distances to several sets of sources,
+    /// concurrently when OpenMP is enabled.
+    ///
+    /// @param source_sets a vector of sets of source indices.
+    /// @return the vector of distance 0-forms, one per set of sources.
+    std::vector<DualForm0> computeBatch( const std::vector<Indices>& source_sets ) const
+    {
+      std::vector<DualForm0> distances( source_sets.size(), DualForm0( *ptrCalculus ) );
+      const int nb = static_cast<int>( source_sets.size() );
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+      for ( int i = 0; i < nb; ++i )
+        distances[ i ] = compute( source_sets[ i ] );
+      return distances;
+    }
+
+    /// @}
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+    /// A smart (or not) pointer to a calculus object.
+    CountedConstPtrOrConstPtr< Calculus > ptrCalculus;
+    /// The dual edges, i.e. the pairs of adjacent 2-cells.
+    std::vector<DualEdge>    dual_edges;
+    /// The prefactorized heat diffusion system.
+    Solver                   heat_solver;
+    /// The prefactorized Poisson system.
+    Solver                   poisson_solver;
+    /// The diffusion time.
+    Scalar                   time_step;
+    /// Tells the verbose level.
+    int                      verbose;
+
+    // ------------------------- Internals ------------------------------------
+  protected:
+
+    /// Extracts the dual edges of the calculus and factorizes the
+    /// heat and Poisson systems, so that distance computations never
+    /// modify the calculus.
+    void init()
+    {
+      if ( verbose >= 1 ) trace.beginBlock( "[GeodesicsInHeat::init] Prefactoring heat and Poisson systems" );
+      const KSpace& K = ptrCalculus->myKSpace;
+      // Each row of the dual derivative joins two adjacent 2-cells
+      // (only one on the boundary of open surfaces).
+      typedef typename Calculus::SparseMatrix SparseMatrix;
+      const SparseMatrix D0 = ptrCalculus->template derivative<0, DUAL>().myContainer;
+      std::vector<Index> first ( D0.rows(), -1 );
+      std::vector<Index> second( D0.rows(), -1 );
+      for ( Index s = 0; s < D0.outerSize(); ++s )
+        for ( typename SparseMatrix::InnerIterator it( D0, s ); it; ++it )
+          ( first[ it.row() ] < 0 ? first[ it.row() ] : second[ it.row() ] ) = s;
+      dual_edges.clear();
+      for ( Index e = 0; e < D0.rows(); ++e )
+        {
+          if ( second[ e ] < 0 ) continue;
+          const auto l  = K.sKCoords( ptrCalculus->getSCell( 1, DUAL, e ) );
+          const auto c1 = K.sKCoords( ptrCalculus->getSCell( 0, DUAL, first[ e ] ) );
+          const auto c2 = K.sKCoords( ptrCalculus->getSCell( 0, DUAL, second[ e ] ) );
+          RealVector d1, d2;
+          for ( Dimension k = 0; k < dimension; ++k )
+            {
+              d1[ k ] = Scalar( l[ k ] - c1[ k ] );
+              d2[ k ] = Scalar( l[ k ] - c2[ k ] );
+            }
+          dual_edges.push_back( DualEdge{ first[ e ], second[ e ], d1, d2 } );
+        }
+      // The dual Laplace operator is positive semi-definite.
+      const DualIdentity0 laplace = ptrCalculus->template laplace<DUAL>();
+      const DualIdentity0 id0     = ptrCalculus->template identity<0, DUAL>();
+      heat_solver.compute( id0 + time_step * laplace );
+      // Closed surfaces have constant harmonic functions, so the
+      // Poisson system is slightly regularized. Distances are shifted
+      // afterwards anyway.
+      poisson_solver.compute( laplace + 1e-8 * id0 );
+      if ( verbose >= 1 )
+        trace.info() << "dt=" << time_step << " edges=" << dual_edges.size()
+                     << " heat=" << ( heat_solver.isValid() ? "OK" : "ERROR" )
+                     << " poisson=" << ( poisson_solver.isValid() ? "OK" : "ERROR" ) << std::endl;
+      if ( verbose >= 1 ) trace.endBlock();
+    }
+
+  }; // end of class GeodesicsInHeat
+
+} // namespace DGtal
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined GeodesicsInHeat_h
+
+#undef GeodesicsInHeat_RECURSES
+#endif // else defined(GeodesicsInHeat_RECURSES)
@@ -0,0 +1,501 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file MatrixFreeLinearOperator.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module MatrixFreeLinearOperator.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(MatrixFreeLinearOperator_RECURSES)
+#error Recursive header files inclusion detected in MatrixFreeLinearOperator.h
+#else // defined(MatrixFreeLinearOperator_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define MatrixFreeLinearOperator_RECURSES
+
+#if !defined MatrixFreeLinearOperator_h
+/** Prevents repeated inclusion of headers. */
+#define MatrixFreeLinearOperator_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/math/linalg/EigenSupport.h"
+#include "DGtal/dec/Duality.h"
+#include "DGtal/dec/KForm.h"
+#include "DGtal/dec/LinearOperator.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class MatrixFreeDiagonalPreconditioner
+  /**
+   * Description of template class 'MatrixFreeDiagonalPreconditioner' <p>
+   * \brief Aim:
+   * Jacobi preconditioner for Eigen iterative solvers working on
+   * matrix-free operators. It is Eigen::DiagonalPreconditioner, except
+   * that the diagonal is given by the method \c diagonal() of the
+   * operator instead of being read in its coefficients.
+   *
+   * @tparam TScalar the scalar type (e.g. double).
+   * @see MatrixFreeLinearOperator
+   */
+  template <typename TScalar>
+  class MatrixFreeDiagonalPreconditioner
+    : public Eigen::DiagonalPreconditioner<TScalar>
+  {
+  public:
+    typedef MatrixFreeDiagonalPreconditioner<TScalar> Self;
+    typedef Eigen::DiagonalPreconditioner<TScalar> Base;
+
+    /// Constructor. The preconditioner is the identity until compute() is called.
+    MatrixFreeDiagonalPreconditioner() : Base() {}
+
+    /// Does nothing, the preconditioner depends on the operator values.
+    /// @return *this.
+    template <typename MatType>
+    Self& analyzePattern(const MatType&) { return *this; }
+
+    /// Inverts the diagonal of \a mat, like compute().
+    /// @return *this.
+    template <typename MatType>
+    Self& factorize(const MatType& mat) { return compute( mat ); }
+
+    /// Inverts the diagonal of \a mat. Zero diagonal coefficients are
+    /// replaced by one.
+    /// @param mat any operator with a method \c diagonal().
+    /// @return *this.
+    template <typename MatType>
+    Self& compute(const MatType& mat)
+    {
+      this->m_invdiag = mat.diagonal();
+      for ( Eigen::Index i = 0; i < this->m_invdiag.size(); i++ )
+        this->m_invdiag( i ) = ( this->m_invdiag( i ) != TScalar( 0 ) )
+          ? TScalar( 1 ) / this->m_invdiag( i ) : TScalar( 1 );
+      this->m_isInitialized = true;
+      return *this;
+    }
+  }; // end of class MatrixFreeDiagonalPreconditioner
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class MatrixFreeLinearOperator
+  /**
+   * Description of template class 'MatrixFreeLinearOperator' <p>
+   * \brief Aim:
+   * MatrixFreeLinearOperator represents a sum of compositions of
+   * discrete linear operators (derivatives, hodges, diagonals) between
+   * discrete kforms, which is applied on the fly to kforms instead of
+   * being multiplied out into a sparse matrix.
+   *
+   * Each term is \f$ s L \mathrm{diag}(w) R \f$, where the left
+   * operator \f$ L \f$, the weights \f$ w \f$ and the right operator
+   * \f$ R \f$ may be omitted. Typical operators of variational
+   * problems, like \f$ \alpha \mathrm{Id} + B^T \mathrm{diag}(w) B
+   * \f$, are thus applied with two sparse matrix-vector products, while
+   * the weights may change at each iteration without any sparse
+   * matrix-matrix product.
+   *
+   * Operators are stored once in row-major order. Matrix-vector
+   * products are parallelized over rows (OpenMP) and weights are
+   * applied with vectorized coefficient-wise products.
+   *
+   * This class is an Eigen matrix-free operator: it may be given to
+   * Eigen iterative solvers (see SolverConjugateGradient and
+   * SolverBiCGSTAB) directly or through DiscreteExteriorCalculusSolver.
+   *
+   * @code
+   * typedef MatrixFreeLinearOperator<Calculus, 2, PRIMAL, 2, PRIMAL> Operator;
+   * Operator ope( calculus );
+   * ope.addOperator( alpha_Id2 );
+   * ope.addNormalComposition( primal_AD2, v1_squared );
+   * DiscreteExteriorCalculusSolver<Calculus, Operator::SolverConjugateGradient,
+   *                                2, PRIMAL, 2, PRIMAL> solver;
+   * solver.compute( ope );
+   * u2 = solver.solve( alpha_g2 );
+   * @endcode
+   *
+   * @note Iterative solvers keep a reference to the operator, which
+   * must not be modified or destroyed while solving. Products reuse
+   * scratch buffers held by the operator, so that solver iterations
+   * do not allocate memory: an operator must not be applied
+   * concurrently by several threads. The conjugate
+   * gradient requires a symmetric operator, e.g. made of normal
+   * compositions and diagonals.
+   *
+   * @tparam TCalculus should be DiscreteExteriorCalculus with EigenLinearAlgebraBackend.
+   * @tparam order_in is the input order of the linear operator.
+   * @tparam duality_in is the input duality of the linear operator.
+   * @tparam order_out is the output order of the linear operator.
+   * @tparam duality_out is the output duality of the linear operator.
+   */
+  template <typename TCalculus, Order order_in, Duality duality_in, Order order_out, Duality duality_out>
+  class MatrixFreeLinearOperator
+    : public Eigen::EigenBase< MatrixFreeLinearOperator<TCalculus, order_in, duality_in, order_out, duality_out> >
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+    typedef TCalculus Calculus;
+    typedef MatrixFreeLinearOperator<Calculus, order_in, duality_in, order_out, duality_out> Self;
+
+    BOOST_STATIC_ASSERT(( order_in >= 0 ));
+    BOOST_STATIC_ASSERT(( order_in <= Calculus::dimensionEmbedded ));
+    BOOST_STATIC_ASSERT(( order_out >= 0 ));
+    BOOST_STATIC_ASSERT(( order_out <= Calculus::dimensionEmbedded ));
+
+    ///Calculus scalar type
+    typedef typename Calculus::Scalar Scalar;
+    ///Real scalar type (for Eigen)
+    typedef Scalar RealScalar;
+    ///Index type
+    typedef typename Calculus::Index Index;
+    ///Storage index type (for Eigen)
+    typedef typename Calculus::SparseMatrix::StorageIndex StorageIndex;
+    ///Dense vector type
+    typedef typename Calculus::DenseVector DenseVector;
+    ///Row-major sparse matrix type used to store operators
+    typedef Eigen::SparseMatrix<Scalar, Eigen::RowMajor, StorageIndex> RowMajorMatrix;
+    ///Input KForm type
+    typedef KForm<Calculus, order_in, duality_in> InputKForm;
+    ///Output KForm type
+    typedef KForm<Calculus, order_out, duality_out> OutputKForm;
+    ///Equivalent explicit operator type
+    typedef LinearOperator<Calculus, order_in, duality_in, order_out, duality_out> Operator;
+    ///Jacobi preconditioner type
+    typedef MatrixFreeDiagonalPreconditioner<Scalar> Preconditioner;
+    ///Conjugate gradient solver (symmetric operators)
+    typedef Eigen::ConjugateGradient<Self, Eigen::Lower|Eigen::Upper, Preconditioner> SolverConjugateGradient;
+    ///Biconjugate gradient stabilized solver
+    typedef Eigen::BiCGSTAB<Self, Preconditioner> SolverBiCGSTAB;
+
+    enum {
+      ColsAtCompileTime = Eigen::Dynamic,
+      MaxColsAtCompileTime = Eigen::Dynamic,
+      IsRowMajor = false
+    };
+
+    /**
+     * Constructor. The operator is zero until terms are added.
+     * @param calculus the discrete exterior calculus to use.
+     */
+    MatrixFreeLinearOperator(ConstAlias<Calculus> calculus);
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Pointer to const calculus.
+     */
+    const Calculus* myCalculus;
+
+    /**
+     * Adds the term \f$ s A \f$.
+     * @param linear_operator the operator A.
+     * @param scale the factor s.
+     * @return the index of the added term.
+     */
+    Index addOperator(const Operator& linear_operator, const Scalar scale = 1);
+
+    /**
+     * Adds the term \f$ s \mathrm{Id} \f$. The input and output kforms
+     * must have the same order and duality.
+     * @param scale the factor s.
+     * @return the index of the added term.
+     */
+    Index addIdentity(const Scalar scale = 1);
+
+    /**
+     * Adds the term \f$ s \mathrm{diag}(w) \f$. The input and output
+     * kforms must have the same order and duality.
+     * @param weights the kform w.
+     * @param scale the factor s.
+     * @return the index of the added term.
+     */
+    Index addDiagonal(const InputKForm& weights, const Scalar scale = 1);
+
+    /**
+     * Adds the term \f$ s L \mathrm{diag}(w) R \f$.
+     * @param left the operator L.
+     * @param weights the kform w.
+     * @param right the operator R.
+     * @param scale the factor s.
+     * @return the index of the added term.
+     */
+    template <Order order_mid, Duality duality_mid>
+    Index addComposition(const LinearOperator<Calculus, order_mid, duality_mid, order_out, duality_out>& left,
+                         const KForm<Calculus, order_mid, duality_mid>& weights,
+                         const LinearOperator<Calculus, order_in, duality_in, order_mid, duality_mid>& right,
+                         const Scalar scale = 1);
+
+    /**
+     * Adds the term \f$ s L R \f$.
+     * @param left the operator L.
+     * @param right the operator R.
+     * @param scale the factor s.
+     * @return the index of the added term.
+     */
+    template <Order order_mid, Duality duality_mid>
+    Index addComposition(const LinearOperator<Calculus, order_mid, duality_mid, order_out, duality_out>& left,
+                         const LinearOperator<Calculus, order_in, duality_in, order_mid, duality_mid>& right,
+                         const Scalar scale = 1);
+
+    /**
+     * Adds the symmetric term \f$ s B^T \mathrm{diag}(w) B \f$. The
+     * input and output kforms must have the same order and duality.
+     * @param linear_operator the operator B.
+     * @param weights the kform w.
+     * @param scale the factor s.
+     * @return the index of the added term.
+     */
+    template <Order order_mid, Duality duality_mid>
+    Index addNormalComposition(const LinearOperator<Calculus, order_in, duality_in, order_mid, duality_mid>& linear_operator,
+                               const KForm<Calculus, order_mid, duality_mid>& weights,
+                               const Scalar scale = 1);
+
+    /**
+     * Adds the symmetric term \f$ s B^T B \f$. The input and output
+     * kforms must have the same order and duality.
+     * @param linear_operator the operator B.
+     * @param scale the factor s.
+     * @return the index of the added term.
+     */
+    template <Order order_mid, Duality duality_mid>
+    Index addNormalComposition(const LinearOperator<Calculus, order_in, duality_in, order_mid, duality_mid>& linear_operator,
+                               const Scalar scale = 1);
+
+    /**
+     * Changes the weights of a term added with weights, without
+     * copying its operators again.
+     * @param term the index of the term.
+     * @param weights the new kform w, of the same length.
+     */
+    template <Order order_mid, Duality duality_mid>
+    void setWeights(const Index term, const KForm<Calculus, order_mid, duality_mid>& weights);
+
+    /**
+     * Changes the factor of a term.
+     * @param term the index of the term.
+     * @param scale the new factor s.
+     */
+    void setScale(const Index term, const Scalar scale);
+
+    /**
+     * @return the number of terms.
+     */
+    Index nbTerms() const;
+
+    /**
+     * Removes all terms, the operator is zero.
+     */
+    void clear();
+
+    /**
+     * @return the number of rows (length of output kforms).
+     */
+    Index rows() const;
+
+    /**
+     * @return the number of columns (length of input kforms).
+     */
+    Index cols() const;
+
+    /**
+     * Computes \f$ y = A x \f$ on containers.
+     * @param x the input vector, of length cols().
+     * @param[out] y the output vector, resized to rows().
+     */
+    void apply(const Eigen::Ref<const DenseVector>& x, DenseVector& y) const;
+
+    /**
+     * Computes \f$ y = y + \alpha A x \f$ without temporary vectors.
+     * @tparam TOutput any writable Eigen dense vector type.
+     * @param x the input vector, of length cols(). Contiguous vectors
+     * are used in place, other expressions are evaluated once.
+     * @param[in,out] y the output vector, of length rows(), which must
+     * not alias \a x.
+     * @param alpha the factor.
+     */
+    template <typename TOutput>
+    void addApply(const Eigen::Ref<const DenseVector>& x, TOutput& y, const Scalar alpha = 1) const;
+
+    /**
+     * Computes the diagonal of the operator, e.g. for Jacobi
+     * preconditioning.
+     * @return the vector of diagonal coefficients.
+     */
+    DenseVector diagonal() const;
+
+    /**
+     * Builds the explicit sparse operator, e.g. to use a direct
+     * solver. This performs the sparse matrix-matrix products that
+     * this class avoids.
+     * @return the equivalent linear operator.
+     */
+    Operator toLinearOperator() const;
+
+    /**
+     * Product with an Eigen dense vector, as used by Eigen iterative
+     * solvers.
+     * @param x any Eigen dense vector expression.
+     * @return the product expression.
+     */
+    template <typename Rhs>
+    Eigen::Product<Self, Rhs, Eigen::AliasFreeProduct>
+    operator*(const Eigen::MatrixBase<Rhs>& x) const
+    {
+      return Eigen::Product<Self, Rhs, Eigen::AliasFreeProduct>( *this, x.derived() );
+    }
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay(std::ostream& out) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// One term s L diag(w) R, where L, w or R may be omitted.
+    struct Term
+    {
+      Scalar scale;
+      bool has_left;
+      bool has_weights;
+      bool has_right;
+      bool is_normal; ///< L is the transpose of R
+      RowMajorMatrix left;
+      DenseVector weights;
+      RowMajorMatrix right;
+    };
+
+    /// The terms of the sum.
+    std::vector<Term> myTerms;
+
+    /// Scratch buffers holding the intermediate forms of a term.
+    mutable DenseVector myBufferA, myBufferB;
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /**
+     * Constructor.
+     * Forbidden by default (protected to avoid g++ warnings).
+     */
+    MatrixFreeLinearOperator();
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Adds a term and checks its sizes.
+     * @param term the term.
+     * @return the index of the added term.
+     */
+    Index addTerm(Term&& term);
+
+    /**
+     * Computes \f$ y = M x \f$, in parallel over rows.
+     * @param matrix the row-major matrix M.
+     * @param x the input vector.
+     * @param[out] y the output vector, resized only if needed.
+     */
+    static void multiply(const RowMajorMatrix& matrix, const Eigen::Ref<const DenseVector>& x, DenseVector& y);
+
+  }; // end of class MatrixFreeLinearOperator
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'MatrixFreeLinearOperator'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'MatrixFreeLinearOperator' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename Calculus, Order order_in, Duality duality_in, Order order_out, Duality duality_out>
+  std::ostream&
+  operator<<(std::ostream& out,
+             const MatrixFreeLinearOperator<Calculus, order_in, duality_in, order_out, duality_out>& object);
+
+  /**
+   * Overloads 'operator*' for application of objects of class 'MatrixFreeLinearOperator' on objects of class 'KForm'.
+   * @param linear_operator left operant
+   * @param input_form right operant
+   * @return linear_operator * input_form.
+   */
+  template <typename Calculus, Order order_in, Duality duality_in, Order order_out, Duality duality_out>
+  KForm<Calculus, order_out, duality_out>
+  operator*(const MatrixFreeLinearOperator<Calculus, order_in, duality_in, order_out, duality_out>& linear_operator,
+            const KForm<Calculus, order_in, duality_in>& input_form);
+
+} // namespace DGtal
+
+namespace Eigen
+{
+  namespace internal
+  {
+    /// MatrixFreeLinearOperator is seen by Eigen as a sparse matrix.
+    template <typename Calculus, DGtal::Order order_in, DGtal::Duality duality_in, DGtal::Order order_out, DGtal::Duality duality_out>
+    struct traits< DGtal::MatrixFreeLinearOperator<Calculus, order_in, duality_in, order_out, duality_out> >
+      : public traits< typename Calculus::SparseMatrix >
+    {};
+
+    /// Product of a MatrixFreeLinearOperator with a dense vector.
+    template <typename Calculus, DGtal::Order order_in, DGtal::Duality duality_in, DGtal::Order order_out, DGtal::Duality duality_out, typename Rhs>
+    struct generic_product_impl< DGtal::MatrixFreeLinearOperator<Calculus, order_in, duality_in, order_out, duality_out>,
+                                 Rhs, SparseShape, DenseShape, GemvProduct >
+      : generic_product_impl_base< DGtal::MatrixFreeLinearOperator<Calculus, order_in, duality_in, order_out, duality_out>, Rhs,
+                                   generic_product_impl< DGtal::MatrixFreeLinearOperator<Calculus, order_in, duality_in, order_out, duality_out>, Rhs > >
+    {
+      typedef DGtal::MatrixFreeLinearOperator<Calculus, order_in, duality_in, order_out, duality_out> Lhs;
+      typedef typename Product<Lhs, Rhs>::Scalar Scalar;
+
+      template <typename Dest>
+      static void scaleAndAddTo(Dest& dst, const Lhs& lhs, const Rhs& rhs, const Scalar& alpha)
+      {
+        lhs.addApply( rhs, dst, alpha );
+      }
+    };
+  } // namespace internal
+} // namespace Eigen
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/dec/MatrixFreeLinearOperator.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined MatrixFreeLinearOperator_h
+
+#undef MatrixFreeLinearOperator_RECURSES
+#endif // else defined(MatrixFreeLinearOperator_RECURSES)
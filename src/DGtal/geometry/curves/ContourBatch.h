@@ -0,0 +1,226 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ContourBatch.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module ContourBatch.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ContourBatch_RECURSES)
+#error Recursive header files inclusion detected in ContourBatch.h
+#else // defined(ContourBatch_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ContourBatch_RECURSES
+
+#if !defined ContourBatch_h
+/** Prevents repeated inclusion of headers. */
+#define ContourBatch_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Circulator.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ContourBatch
+  /**
+   * Description of template class 'ContourBatch' <p>
+   * \brief Aim: stores a collection of digital contours (typically the
+   * boundaries extracted from all the slices of a volume) in a single
+   * flat array of points.
+   *
+   * Contour \a c occupies the points of indices \a offset(c) to \a
+   * offset(c+1) - 1 of the array returned by points(). Any quantity
+   * computed per point (see BatchCurveEstimation) is stored in an
+   * array of size nbPoints() with the same layout, so that the value
+   * of the \a i-th point of contour \a c lies at index \a offset(c)+i.
+   *
+   * Contours are added from any range of points, for instance the
+   * points of a FreemanChain (FreemanChain::begin(), FreemanChain::end())
+   * or the range GridCurve::getPointsRange().
+   *
+   * @code
+   * ContourBatch<Z2i::Point> batch;
+   * for ( auto & fc : chains )
+   *   batch.addContour( fc.begin(), fc.end() );
+   * for ( ContourBatch<Z2i::Point>::Size c = 0; c < batch.nbContours(); ++c )
+   *   for ( auto it = batch.begin( c ); it != batch.end( c ); ++it )
+   *     ...
+   * @endcode
+   *
+   * @tparam TPoint the type of the contour points (e.g. Z2i::Point).
+   *
+   * @see BatchCurveEstimation
+   */
+  template <typename TPoint>
+  class ContourBatch
+  {
+    // ----------------------- Types ------------------------------
+  public:
+    typedef TPoint Point;
+    typedef std::vector<Point> Container;
+    typedef typename Container::size_type Size;
+    /// Iterator on the points of one contour (open traversal).
+    typedef typename Container::const_iterator ConstIterator;
+    /// Circulator on the points of one contour (closed traversal).
+    typedef Circulator<ConstIterator> ConstCirculator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. The batch is empty.
+     */
+    ContourBatch();
+
+    /**
+     * Removes all the contours.
+     */
+    void clear();
+
+    /**
+     * Preallocates memory.
+     * @param nbContours the expected number of contours.
+     * @param nbPoints the expected total number of points.
+     */
+    void reserve( Size nbContours, Size nbPoints );
+
+    /**
+     * Appends a contour given by a range of points.
+     * @tparam TIterator a model of forward iterator on points.
+     * @param itb begin iterator of the range.
+     * @param ite end iterator of the range.
+     * @return the index of the new contour.
+     */
+    template <typename TIterator>
+    Size addContour( TIterator itb, TIterator ite );
+
+    /**
+     * @return the number of contours.
+     */
+    Size nbContours() const;
+
+    /**
+     * @return the total number of points of all the contours.
+     */
+    Size nbPoints() const;
+
+    /**
+     * @param c any contour index.
+     * @return the index in points() of the first point of contour @a c.
+     */
+    Size offset( Size c ) const;
+
+    /**
+     * @param c any contour index.
+     * @return the number of points of contour @a c.
+     */
+    Size size( Size c ) const;
+
+    /**
+     * @param c any contour index.
+     * @return an iterator on the first point of contour @a c.
+     */
+    ConstIterator begin( Size c ) const;
+
+    /**
+     * @param c any contour index.
+     * @return an iterator after the last point of contour @a c.
+     */
+    ConstIterator end( Size c ) const;
+
+    /**
+     * @param c any contour index (the contour must not be empty).
+     * @return a circulator on the first point of contour @a c.
+     */
+    ConstCirculator circulator( Size c ) const;
+
+    /**
+     * @param c any contour index.
+     * @param i any point index in contour @a c.
+     * @return the @a i-th point of contour @a c.
+     */
+    const Point & point( Size c, Size i ) const;
+
+    /**
+     * @return the flat array of the points of all the contours.
+     */
+    const Container & points() const;
+
+    /**
+     * @return the array of the nbContours()+1 contour offsets.
+     */
+    const std::vector<Size> & offsets() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The points of all the contours, contour after contour.
+    Container myPoints;
+    /// The offset of each contour in myPoints, followed by myPoints.size().
+    std::vector<Size> myOffsets;
+
+  }; // end of class ContourBatch
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ContourBatch'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ContourBatch' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TPoint>
+  std::ostream&
+  operator<< ( std::ostream & out, const ContourBatch<TPoint> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/curves/ContourBatch.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ContourBatch_h
+
+#undef ContourBatch_RECURSES
+#endif // else defined(ContourBatch_RECURSES)
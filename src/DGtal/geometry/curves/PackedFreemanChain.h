@@ -0,0 +1,337 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file PackedFreemanChain.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module PackedFreemanChain.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(PackedFreemanChain_RECURSES)
+#error Recursive header files inclusion detected in PackedFreemanChain.h
+#else // defined(PackedFreemanChain_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define PackedFreemanChain_RECURSES
+
+#if !defined PackedFreemanChain_h
+/** Prevents repeated inclusion of headers. */
+#define PackedFreemanChain_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/CInteger.h"
+#include "DGtal/kernel/PointVector.h"
+#include "DGtal/geometry/curves/FreemanChain.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  namespace detail
+  {
+    /**
+     * Lookup tables giving, for each byte of a packed chain code (four
+     * 2-bit codes, first code in the low bits), the positions reached
+     * after each step, the extremal positions and the area term of the
+     * four steps, relatively to the position before the byte.
+     */
+    struct PackedFreemanChainTables
+    {
+      /// Position after the k-th step of the byte (k=0..3).
+      signed char dx[ 256 ][ 4 ];
+      signed char dy[ 256 ][ 4 ];
+      /// Extremal positions reached within the byte (start included).
+      signed char minX[ 256 ], maxX[ 256 ], minY[ 256 ], maxY[ 256 ];
+      /// Sum of x_k*dy_k - y_k*dx_k over the steps of the byte.
+      signed char area[ 256 ];
+
+      /// @return the tables, computed once.
+      static const PackedFreemanChainTables & get();
+    };
+  } // namespace detail
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class PackedFreemanChain
+  /**
+   * Description of template class 'PackedFreemanChain' <p>
+   * \brief Aim: a compact representation of a 4-connected digital
+   * path (Freeman chain code) storing each code on 2 bits, 32 codes
+   * per 64-bit word, i.e. 4 times less memory than FreemanChain.
+   *
+   * Codes are the ones of FreemanChain: 0 (east), 1 (north), 2 (west)
+   * and 3 (south), here stored as integers. Geometric services work
+   * directly on the packed codes, one byte (four codes) at a time
+   * through lookup tables:
+   * - getPoints() decodes all the points of the path at once as prefix
+   *   sums of the displacement vectors;
+   * - computeBoundingBox() and twiceSignedArea() never build the points.
+   *
+   * The last point is maintained, so that isClosed() and lastPoint()
+   * take O(1) operations.
+   *
+   * Chains are saved in a compact binary format (see write() and
+   * read()): a header followed by the little-endian 64-bit words of
+   * each chain, so that millions of contours are saved and loaded by
+   * large blocks.
+   *
+   * @code
+   * FreemanChain<int> fc( "00112233", 0, 0 );
+   * PackedFreemanChain<int> pfc( fc );
+   * std::vector< PackedFreemanChain<int>::Point > points;
+   * pfc.getPoints( points ); // 9 points, from (0,0) back to (0,0)
+   * int area2 = pfc.twiceSignedArea(); // 8
+   * @endcode
+   *
+   * @tparam TInteger a model of CInteger for the point coordinates.
+   *
+   * @see FreemanChain
+   * @see testPackedFreemanChain.cpp
+   */
+  template <typename TInteger>
+  class PackedFreemanChain
+  {
+    BOOST_CONCEPT_ASSERT(( concepts::CInteger<TInteger> ));
+
+    // ----------------------- Types ------------------------------
+  public:
+    typedef TInteger Integer;
+    typedef PointVector<2, Integer> Point;
+    typedef PointVector<2, Integer> Vector;
+    typedef DGtal::FreemanChain<Integer> FreemanChain;
+    typedef DGtal::uint64_t Word;
+    typedef std::size_t Size;
+    typedef std::size_t Index;
+
+    /// Number of codes stored in one word.
+    static const Size CODES_PER_WORD = 32;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. The chain is empty.
+     * @param x the x-coordinate of the first point.
+     * @param y the y-coordinate of the first point.
+     */
+    PackedFreemanChain( Integer x = 0, Integer y = 0 );
+
+    /**
+     * Constructor from a string of codes.
+     * @param s a string of characters '0' to '3'.
+     * @param x the x-coordinate of the first point.
+     * @param y the y-coordinate of the first point.
+     */
+    PackedFreemanChain( const std::string & s, Integer x, Integer y );
+
+    /**
+     * Constructor from a FreemanChain.
+     * @param fc any Freeman chain.
+     */
+    explicit PackedFreemanChain( const FreemanChain & fc );
+
+    /**
+     * Removes all the codes. The first point is unchanged.
+     */
+    void clear();
+
+    /**
+     * Preallocates memory.
+     * @param n the expected number of codes.
+     */
+    void reserve( Size n );
+
+    /**
+     * Appends a code (the last point is moved accordingly).
+     * @param aCode a code in 0..3.
+     */
+    void push_back( unsigned int aCode );
+
+    /**
+     * @param i any position in 0..size()-1.
+     * @return the code at position @a i.
+     */
+    unsigned int code( Index i ) const;
+
+    /**
+     * @return the number of codes of the chain.
+     */
+    Size size() const;
+
+    /**
+     * @return the first point of the chain.
+     */
+    Point firstPoint() const;
+
+    /**
+     * @return the last point of the chain.
+     */
+    Point lastPoint() const;
+
+    /**
+     * @return the displacement from the first to the last point.
+     */
+    Vector totalDisplacement() const;
+
+    /**
+     * @return 'true' if the last point is the first one.
+     */
+    bool isClosed() const;
+
+    /**
+     * @return the equivalent FreemanChain.
+     */
+    FreemanChain toFreemanChain() const;
+
+    /**
+     * @return the packed codes, CODES_PER_WORD per word, the first code
+     * in the low bits.
+     */
+    const std::vector<Word> & words() const;
+
+    // ----------------------- Geometric services ------------------------------
+  public:
+
+    /**
+     * Decodes the size()+1 points of the chain.
+     * @param[out] points the points, from firstPoint() to lastPoint().
+     */
+    void getPoints( std::vector<Point> & points ) const;
+
+    /**
+     * Decodes the size()+1 points of the chain.
+     * @tparam TOutputIterator a model of output iterator on Point.
+     * @param out the output iterator.
+     * @return the output iterator after the last written point.
+     */
+    template <typename TOutputIterator>
+    TOutputIterator getPoints( TOutputIterator out ) const;
+
+    /**
+     * Computes the bounding box of the points of the chain, in
+     * O(size()/4) operations.
+     *
+     * @param[out] min_x the minimal x-coordinate.
+     * @param[out] min_y the minimal y-coordinate.
+     * @param[out] max_x the maximal x-coordinate.
+     * @param[out] max_y the maximal y-coordinate.
+     */
+    void computeBoundingBox( Integer & min_x, Integer & min_y,
+                             Integer & max_x, Integer & max_y ) const;
+
+    /**
+     * Computes twice the signed area enclosed by the polygon of the
+     * points of the chain (closed by the segment from the last point to
+     * the first one), in O(size()/4) operations. It is positive for
+     * counterclockwise contours.
+     *
+     * @return twice the signed area (an integer).
+     */
+    Integer twiceSignedArea() const;
+
+    // ----------------------- I/O services ------------------------------
+  public:
+
+    /**
+     * Writes chains in the binary format: the magic string "PFC1", the
+     * number of chains, then for each chain its first point, its number
+     * of codes and its words (all as little-endian 64-bit words).
+     *
+     * @param out the output stream (opened in binary mode).
+     * @param chains the chains to write.
+     * @throw IOException if the stream cannot be written.
+     */
+    static void write( std::ostream & out,
+                       const std::vector<PackedFreemanChain> & chains );
+
+    /**
+     * Reads chains written by write().
+     *
+     * @param in the input stream (opened in binary mode).
+     * @param[out] chains the chains read.
+     * @throw IOException if the stream is not in the expected format.
+     */
+    static void read( std::istream & in,
+                      std::vector<PackedFreemanChain> & chains );
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// Coordinates of the first point.
+    Integer myX0, myY0;
+    /// Coordinates of the last point.
+    Integer myXn, myYn;
+    /// Number of codes.
+    Size mySize;
+    /// Packed codes.
+    std::vector<Word> myWords;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @param i any position in the words.
+     * @return the byte of codes 4i to 4i+3.
+     */
+    unsigned int byte( Index i ) const;
+
+  }; // end of class PackedFreemanChain
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'PackedFreemanChain'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'PackedFreemanChain' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TInteger>
+  std::ostream&
+  operator<< ( std::ostream & out, const PackedFreemanChain<TInteger> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/curves/PackedFreemanChain.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined PackedFreemanChain_h
+
+#undef PackedFreemanChain_RECURSES
+#endif // else defined(PackedFreemanChain_RECURSES)
@@ -41,7 +41,9 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
 #include "DGtal/base/Common.h"
+#include "DGtal/base/IteratorFunctions.h"
 
 #include "DGtal/geometry/curves/SegmentComputerUtils.h"
 #include "DGtal/geometry/curves/CForwardSegmentComputer.h"
@@ -144,6 +146,18 @@ namespace DGtal
    * use the setMode() method as follow: 
    * @code 
   theSegmentation.setMode("First");
+   * @endcode  
+   * 
+   * Maximal segments are computed on the fly by a sequential sweep.
+   * On very long curves given by random-access iterators or
+   * circulators, they may be computed beforehand by
+   * computeMaximalSegments(), which splits the range into chunks
+   * processed concurrently (OpenMP builds) and stitches the segments
+   * spanning the chunk boundaries. The segmentation then walks through
+   * the precomputed segments, and retrieves exactly the same segments
+   * as the sequential sweep, whatever the subrange and the mode.
+   * @code 
+  theSegmentation.computeMaximalSegments();
    * @endcode  
    * 
    * @see testSegmentation.cpp
@@ -232,7 +246,11 @@ namespace DGtal
        */
       bool  myFlagIsLast;
 
-
+      /**
+       * Index of the current segment in the precomputed maximal
+       * segments of the segmentation (if any).
+       */
+      std::size_t myIndex;
 
       // ------------------------- Standard services -----------------------
     public:
@@ -433,6 +451,35 @@ namespace DGtal
      */
     void setMode(const std::string& aMode);
 
+    /**
+     * Computes once all the maximal segments of the underlying range.
+     * The range is split into @a nbChunks chunks of consecutive
+     * elements. Each chunk starts from the first maximal segment
+     * passing through its first element and keeps the successive
+     * maximal segments that begin within the chunk. Chunks are
+     * processed concurrently (OpenMP builds) and their segments are
+     * concatenated, so that the result is exactly the set of maximal
+     * segments given by the sequential sweep.
+     *
+     * Afterwards, the segmentation iterators walk through these
+     * precomputed segments instead of computing them.
+     *
+     * Nb: the precomputation is skipped (and the sequential sweep
+     * used) when ConstIterator is not a random-access iterator or
+     * circulator, and when a single segment covers a whole circular
+     * range.
+     *
+     * @param nbChunks the number of chunks, 0 (default) for an
+     * automatic choice (a few chunks per thread).
+     */
+    void computeMaximalSegments( unsigned int nbChunks = 0 );
+
+    /**
+     * @return the maximal segments computed by
+     * computeMaximalSegments(), in the order of their first element
+     * (empty if they were not computed).
+     */
+    const std::vector<SegmentComputer> & maximalSegments() const;
 
     /**
      * Destructor.
@@ -499,6 +546,11 @@ namespace DGtal
      */
     SegmentComputer mySegmentComputer;
 
+    /**
+     * The maximal segments of the whole range, when precomputed.
+     */
+    std::vector<SegmentComputer> myMaximalSegments;
+
     // ------------------------- Hidden services ------------------------------
 
 
@@ -520,6 +572,28 @@ namespace DGtal
     // ------------------------- Internals ------------------------------------
   private:
 
+    /**
+     * @param aSegment a maximal segment of the underlying range.
+     * @return the index of @a aSegment in myMaximalSegments.
+     */
+    std::size_t indexOfMaximalSegment( const SegmentComputer & aSegment ) const;
+    std::size_t indexOfMaximalSegment( const SegmentComputer & aSegment,
+                                       RandomAccessCategory ) const;
+    std::size_t indexOfMaximalSegment( const SegmentComputer & aSegment,
+                                       ForwardCategory ) const;
+
+    /**
+     * Computes the maximal segments by chunks (random-access ranges).
+     * @param nbChunks the number of chunks (0 for an automatic choice).
+     */
+    void computeMaximalSegments( unsigned int nbChunks, RandomAccessCategory );
+
+    /**
+     * Does nothing: chunks require random-access ranges.
+     * @param nbChunks the number of chunks (unused).
+     */
+    void computeMaximalSegments( unsigned int nbChunks, ForwardCategory );
+
   }; // end of class SaturatedSegmentation
 
 
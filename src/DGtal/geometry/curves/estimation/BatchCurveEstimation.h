@@ -0,0 +1,235 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file BatchCurveEstimation.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module BatchCurveEstimation.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(BatchCurveEstimation_RECURSES)
+#error Recursive header files inclusion detected in BatchCurveEstimation.h
+#else // defined(BatchCurveEstimation_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define BatchCurveEstimation_RECURSES
+
+#if !defined BatchCurveEstimation_h
+/** Prevents repeated inclusion of headers. */
+#define BatchCurveEstimation_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/IteratorCirculatorTraits.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/geometry/curves/ContourBatch.h"
+#include "DGtal/geometry/curves/estimation/MostCenteredMaximalSegmentEstimator.h"
+#include "DGtal/geometry/curves/estimation/LambdaMST2D.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  namespace detail
+  {
+    /**
+     * Gives access to the contours of a ContourBatch with the iterator
+     * type expected by a segment computer: a plain iterator for an open
+     * traversal, a circulator for a closed one.
+     */
+    template <typename TBatch, typename TIterator,
+              typename TTag = typename IteratorCirculatorType<TIterator>::Type>
+    struct ContourBatchTraversal
+    {
+      static TIterator begin( const TBatch & batch, typename TBatch::Size c )
+      { return batch.begin( c ); }
+      static TIterator end( const TBatch & batch, typename TBatch::Size c )
+      { return batch.end( c ); }
+      static typename TBatch::Size index( const TBatch & batch, const TIterator & it )
+      { return it - batch.points().begin(); }
+    };
+
+    template <typename TBatch, typename TIterator>
+    struct ContourBatchTraversal<TBatch, TIterator, CirculatorType>
+    {
+      static TIterator begin( const TBatch & batch, typename TBatch::Size c )
+      { return batch.circulator( c ); }
+      static TIterator end( const TBatch & batch, typename TBatch::Size c )
+      { return batch.circulator( c ); }
+      static typename TBatch::Size index( const TBatch & batch, const TIterator & it )
+      { return it.base() - batch.points().begin(); }
+    };
+  } // namespace detail
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class BatchCurveEstimation
+  /**
+   * Description of class 'BatchCurveEstimation' <p>
+   * \brief Aim: runs curve segmentations and segment-based geometric
+   * estimators (tangent, curvature) on all the contours of a
+   * ContourBatch at once, the contours being processed concurrently
+   * when OpenMP is available.
+   *
+   * Results are returned in flat arrays:
+   * - per-point quantities are stored in an array of size
+   *   ContourBatch::nbPoints(), the quantity of the \a i-th point of
+   *   contour \a c lying at index \a batch.offset(c)+i;
+   * - segments are stored contour after contour, the segments of
+   *   contour \a c having indices \a segmentOffsets[c] to \a
+   *   segmentOffsets[c+1] - 1.
+   *
+   * Each contour is processed exactly as the corresponding single
+   * contour tool would do (GreedySegmentation, SaturatedSegmentation,
+   * MostCenteredMaximalSegmentEstimator, LambdaMST2D), so that the
+   * results do not depend on the number of threads.
+   *
+   * The segment computers must be instantiated with the iterator types
+   * of ContourBatch: ContourBatch::ConstIterator to process contours as
+   * open curves, ContourBatch::ConstCirculator to process them as
+   * closed curves. Empty contours are skipped.
+   *
+   * @code
+   * typedef ContourBatch<Z2i::Point> Batch;
+   * typedef ArithmeticalDSSComputer<Batch::ConstCirculator,int,4> SegmentComputer;
+   * typedef TangentAngleFromDSSEstimator<SegmentComputer> SCEstimator;
+   * std::vector<double> angles;
+   * BatchCurveEstimation::mostCentered( batch, 1.0, SegmentComputer(),
+   *                                     SCEstimator(), angles );
+   * // angles[ batch.offset( c ) + i ] is the tangent angle at the
+   * // i-th point of contour c.
+   * @endcode
+   *
+   * @see ContourBatch
+   */
+  struct BatchCurveEstimation
+  {
+    // ----------------------- Types ------------------------------
+  public:
+    typedef std::size_t Size;
+
+    /**
+     * A segment of a contour, given by the index (in the flat point
+     * array of the batch) of its first point and its number of points.
+     * For closed contours, the segment may wrap around the end of its
+     * contour.
+     */
+    struct Segment
+    {
+      Size first;
+      Size size;
+    };
+
+    // ----------------------- Static services ------------------------------
+  public:
+
+    /**
+     * Segments every contour of @a batch.
+     *
+     * @tparam TSegmentation a segmentation (e.g. GreedySegmentation or
+     * SaturatedSegmentation) over ContourBatch iterators or circulators.
+     * @tparam TPoint the point type of the batch.
+     *
+     * @param[in] batch the contours.
+     * @param[in] sc the segment computer used for each contour.
+     * @param[out] segmentOffsets the nbContours()+1 offsets of the
+     * segments of each contour in @a segments.
+     * @param[out] segments the segments of all the contours.
+     * @param[in] parallel when 'true' (default), the contours are
+     * processed concurrently (OpenMP builds).
+     */
+    template <typename TSegmentation, typename TPoint>
+    static
+    void segmentation( const ContourBatch<TPoint> & batch,
+                       const typename TSegmentation::SegmentComputer & sc,
+                       std::vector<Size> & segmentOffsets,
+                       std::vector<Segment> & segments,
+                       bool parallel = true );
+
+    /**
+     * Estimates a geometric quantity at every point of every contour
+     * of @a batch with a MostCenteredMaximalSegmentEstimator.
+     *
+     * @tparam TSegmentComputer a segment computer over ContourBatch
+     * iterators or circulators.
+     * @tparam TSCEstimator a model of CSegmentComputerEstimator (e.g.
+     * TangentAngleFromDSSEstimator, CurvatureFromDCAEstimator).
+     * @tparam TPoint the point type of the batch.
+     *
+     * @param[in] batch the contours.
+     * @param[in] h the grid step.
+     * @param[in] sc the segment computer used for each contour.
+     * @param[in] sce the segment computer estimator used for each contour.
+     * @param[out] values the nbPoints() estimated quantities.
+     * @param[in] parallel when 'true' (default), the contours are
+     * processed concurrently (OpenMP builds).
+     */
+    template <typename TSegmentComputer, typename TSCEstimator, typename TPoint>
+    static
+    void mostCentered( const ContourBatch<TPoint> & batch, double h,
+                       const TSegmentComputer & sc,
+                       const TSCEstimator & sce,
+                       std::vector<typename TSCEstimator::Quantity> & values,
+                       bool parallel = true );
+
+    /**
+     * Estimates the tangent at every point of every contour of @a
+     * batch with a LambdaMST2D estimator. Contours are processed as
+     * open curves.
+     *
+     * @tparam TSegmentation a segmentation by maximal DSS (typically
+     * SaturatedSegmentation) over ContourBatch::ConstIterator.
+     * @tparam TLambdaFunction the lambda function (see FunctorsLambdaMST.h).
+     * @tparam TPoint the point type of the batch.
+     *
+     * @param[in] batch the contours.
+     * @param[in] sc the segment computer used for each contour.
+     * @param[out] tangents the nbPoints() estimated tangent vectors.
+     * @param[in] parallel when 'true' (default), the contours are
+     * processed concurrently (OpenMP builds).
+     */
+    template <typename TSegmentation,
+              typename TLambdaFunction = functors::Lambda64Function,
+              typename TPoint>
+    static
+    void lambdaMST( const ContourBatch<TPoint> & batch,
+                    const typename TSegmentation::SegmentComputer & sc,
+                    std::vector<Z2i::RealVector> & tangents,
+                    bool parallel = true );
+
+  }; // end of struct BatchCurveEstimation
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/curves/estimation/BatchCurveEstimation.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined BatchCurveEstimation_h
+
+#undef BatchCurveEstimation_RECURSES
+#endif // else defined(BatchCurveEstimation_RECURSES)
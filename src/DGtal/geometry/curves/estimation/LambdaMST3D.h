@@ -40,7 +40,8 @@
 #include <iterator>
 #include <cmath>
 #include <vector>
-#include <map>
+#include <algorithm>
+#include <utility>
 #include <DGtal/base/Common.h>
 #include <DGtal/helpers/StdDefs.h>
 #include "DGtal/kernel/CSpace.h"
@@ -120,6 +121,9 @@ namespace DGtal {
     /**
      * @tparam OutputIterator writable iterator.
      * More efficient way to compute tangent directions for all points of a curve.
+     * The maximal segments are visited once, their partial results are
+     * computed concurrently (with OpenMP, when available) and stored
+     * by point index before being accumulated.
      *
      * @param itb begin iterator
      * @param ite end iterator
@@ -138,6 +142,23 @@ namespace DGtal {
   protected:
 
       typedef typename std::vector<SegmentComputer >::const_iterator OrphanDSSIterator;
+
+    /**
+     * @brief Computes, for each point of the range [@a itb, @a ite),
+     * the index of its first occurrence in the subrange [@a rangeBegin,
+     * @a rangeEnd), or in [@a itb, @a ite) if it does not occur in this
+     * subrange. Partial results of a point visited several times are
+     * gathered at this index.
+     *
+     * @param itb begin iterator
+     * @param ite end iterator
+     * @param rangeBegin begin iterator of the subrange
+     * @param rangeEnd end iterator of the subrange
+     * @param representatives (output) the index of the representative of each point.
+     */
+    void computeRepresentatives ( ConstIterator itb, ConstIterator ite,
+                                  ConstIterator rangeBegin, ConstIterator rangeEnd,
+                                  std::vector < std::size_t > & representatives ) const;
     
     /**
      * @brief Accumulate partial results obtained for each point.
@@ -147,13 +168,21 @@ namespace DGtal {
      * Finally, tangent direction is estimated and stored.
      * 
      * @tparam OutputIterator writable iterator.
-     * @param outValues partial results for each point
+     * @param offsets the partial results of the point at index i of
+     * [@a spanBegin, @a spanEnd) are the values of indices [offsets[i], offsets[i+1]).
+     * @param values partial results of all the points, in the order of the segmentation.
+     * @param representatives the index of the representative of each point.
+     * @param spanBegin begin iterator of the points covered by the segments
+     * @param spanEnd end iterator of the points covered by the segments
      * @param itb begin iterator
      * @param ite end iterator
      * @param result writable iterator over a container which stores estimated tangent directions.
      */
     template <typename OutputIterator>
-    void accumulate ( std::multimap < Point, Value > & outValues, ConstIterator itb, ConstIterator ite, OutputIterator & result );
+    void accumulate ( const std::vector < std::size_t > & offsets, const std::vector < Value > & values,
+                      const std::vector < std::size_t > & representatives,
+                      ConstIterator spanBegin, ConstIterator spanEnd,
+                      ConstIterator itb, ConstIterator ite, OutputIterator & result );
 
     /**
      * @brief Use the DSS filter defined conditions to ensure estimation over not covered points - orphans.
@@ -164,10 +193,19 @@ namespace DGtal {
      * @return estimated tangent
      */
     Value treatOrphan(OrphanDSSIterator begin, OrphanDSSIterator end, const Point &p);
-    template < typename DSSesIterator, typename OrphanIterator >
 
-    void treatOrphans(DSSesIterator begin, DSSesIterator end, OrphanIterator obegin, OrphanIterator oend,
-                       std::multimap<Point, Value> &outValues);
+    /**
+     * @brief Use the DSS filter defined conditions to ensure estimation over not covered points - orphans.
+     *
+     * @param segments all the segments of the segmentation.
+     * @param itb begin iterator of the points covered by the segments.
+     * @param orphans the indices of the orphans from @a itb.
+     * @param outValues (output) the pairs (index of orphan, partial result),
+     * ordered by orphan then by segment.
+     */
+    void treatOrphans ( const std::vector < SegmentComputer > & segments, ConstIterator itb,
+                        const std::vector < std::size_t > & orphans,
+                        std::vector < std::pair < std::size_t, Value > > & outValues );
 
 
     // ------------------------- Private Datas --------------------------------
@@ -72,6 +72,12 @@ namespace DGtal
    - 3. Get the estimations
    @snippet geometry/curves/estimation/exampleCurvature.cpp MostCenteredEvaluation
 
+   On very long curves given by random-access iterators or circulators,
+   setNbChunks() lets the estimation over a range compute the maximal
+   segments by chunks processed concurrently (see
+   SaturatedSegmentation::computeMaximalSegments); estimations are
+   unchanged.
+
    * @tparam SegmentComputer at least a model of CForwardSegmentComputer
    * @tparam SCEstimator a model of CSegmentComputerEstimator
    *
@@ -129,6 +135,15 @@ namespace DGtal
      */
     void init(const double h, const ConstIterator& itb, const ConstIterator& ite);
 
+    /**
+     * Sets the number of chunks used to compute the maximal segments
+     * when estimating over a range (see
+     * SaturatedSegmentation::computeMaximalSegments).
+     * @param nbChunks 1 (default) for the sequential sweep, 0 for an
+     * automatic choice, or any number of chunks.
+     */
+    void setNbChunks(const unsigned int nbChunks);
+
     /**
      * Unique estimation 
      * @param it any valid iterator
@@ -181,6 +196,9 @@ namespace DGtal
     /** object estimating the quantity from segmentComputer */ 
     SCEstimator mySCEstimator;
 
+    /** number of chunks used to compute the maximal segments */
+    unsigned int myNbChunks;
+
     // ------------------------- Internal services ------------------------------
 
   private:
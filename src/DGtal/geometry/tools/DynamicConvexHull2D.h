@@ -0,0 +1,260 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file DynamicConvexHull2D.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module DynamicConvexHull2D.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(DynamicConvexHull2D_RECURSES)
+#error Recursive header files inclusion detected in DynamicConvexHull2D.h
+#else // defined(DynamicConvexHull2D_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define DynamicConvexHull2D_RECURSES
+
+#if !defined DynamicConvexHull2D_h
+/** Prevents repeated inclusion of headers. */
+#define DynamicConvexHull2D_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <set>
+#include "DGtal/base/Common.h"
+#include "DGtal/geometry/tools/determinant/COrientationFunctor2.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class DynamicConvexHull2D
+  /**
+   * Description of template class 'DynamicConvexHull2D' <p>
+   * \brief Aim: This class maintains the convex hull of a set of 2D
+   * points inserted one by one in any order.
+   *
+   * Contrary to MelkmanConvexHull, the input points need not form a
+   * simple polygonal line. The hull is stored as its lower and upper
+   * chains, i.e. the two monotone chains of Andrew's algorithm
+   * [Andrew, 1979 : \cite Andrew1979], kept in two ordered sets.
+   * Inserting a point locates it in each chain, then removes the
+   * neighbouring vertices that are no more extremal, so that an
+   * insertion costs \f$ O(\log n) \f$ amortized time. Testing whether
+   * a point lies in the hull costs \f$ O(\log n) \f$ too.
+   *
+   * Only extremal points are kept: points lying on an edge of the hull
+   * are not vertices. The orientation of three points is computed by
+   * the given orientation functor, e.g. InHalfPlaneBy2x2DetComputer or
+   * InHalfPlaneBySimple3x3Matrix, which is positive for counterclockwise
+   * oriented points.
+   *
+   * @code
+   *  typedef InHalfPlaneBySimple3x3Matrix<Point, DGtal::int64_t> Functor;
+   *  DynamicConvexHull2D<Point, Functor> hull;
+   *  hull.add( Point( 0, 0 ) );
+   *  hull.add( Point( 5, 2 ) );
+   *  hull.add( Point( 2, 6 ) );
+   *  hull.add( Point( 2, 2 ) ); // inside, the hull is not modified
+   *  std::vector<Point> vertices;
+   *  hull.getVertices( std::back_inserter( vertices ) );
+   * @endcode
+   *
+   * @tparam TPoint a model of point (with a lexicographic operator<)
+   * @tparam TOrientationFunctor a model of COrientationFunctor2
+   * (whose inner type 'Point' match to 'TPoint')
+   */
+  template <typename TPoint,
+            typename TOrientationFunctor >
+  class DynamicConvexHull2D
+  {
+    // ----------------------- Types ------------------------------------------
+  public:
+
+    /// Self type
+    typedef DynamicConvexHull2D<TPoint, TOrientationFunctor> Self;
+    /// Type of point
+    typedef TPoint Point;
+    /// Type of orientation functor
+    typedef TOrientationFunctor Functor;
+    BOOST_CONCEPT_ASSERT(( concepts::COrientationFunctor2<Functor> ));
+    //the two types of points must be the same
+    BOOST_STATIC_ASSERT (( boost::is_same< Point, typename Functor::Point >::value ));
+    /// Type of the orientation values
+    typedef typename Functor::Value Value;
+    /// Type of a chain of the hull, ordered lexicographically.
+    typedef std::set<Point> Chain;
+    /// Type of iterator on the vertices of a chain.
+    typedef typename Chain::const_iterator ConstIterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     * @param aFunctor the orientation functor (copied).
+     */
+    DynamicConvexHull2D( const Functor & aFunctor );
+
+    /// Constructor with a default orientation functor.
+    DynamicConvexHull2D();
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Considers a new point and possibly updates the convex hull.
+     * @param aPoint an extra point
+     * @return 'true' if @a aPoint is now a vertex of the hull, 'false'
+     * if it lies in the current hull (which is then not modified).
+     */
+    bool add( const Point & aPoint );
+
+    /**
+     * Considers all the points of the range [ @a itb , @a ite ).
+     * @param itb begin iterator
+     * @param ite end iterator
+     * @tparam ForwardIterator a model of forward and readable iterator
+     */
+    template <typename ForwardIterator>
+    void add( ForwardIterator itb, ForwardIterator ite );
+
+    /**
+     * @param aPoint any point.
+     * @return 'true' if @a aPoint lies in the hull or on its boundary.
+     */
+    bool isInside( const Point & aPoint ) const;
+
+    /// @return the number of vertices of the hull.
+    unsigned int size() const;
+
+    /// @return 'true' if no point has been added.
+    bool empty() const;
+
+    /// Clears the hull.
+    void clear();
+
+    /**
+     * Outputs the vertices of the hull counterclockwise, starting from
+     * its lexicographically smallest vertex.
+     * @param res output iterator used to export the vertices
+     * @return the output iterator after the last vertex.
+     * @tparam OutputIterator a model of incrementable and writable iterator
+     */
+    template <typename OutputIterator>
+    OutputIterator getVertices( OutputIterator res ) const;
+
+    /**
+     * @return the lower chain of the hull, from the lexicographically
+     * smallest to the greatest vertex.
+     */
+    const Chain & lowerHull() const;
+
+    /**
+     * @return the upper chain of the hull, from the lexicographically
+     * smallest to the greatest vertex.
+     */
+    const Chain & upperHull() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the lower and upper chains share their extremities.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// Lower chain, whose consecutive vertices turn counterclockwise.
+    Chain myLower;
+    /// Upper chain, whose consecutive vertices turn clockwise.
+    Chain myUpper;
+    /// Orientation functor (its state changes at each orientation test).
+    mutable Functor myFunctor;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @param a any point
+     * @param b any point
+     * @param c any point
+     * @param upper 'true' for the upper chain, 'false' for the lower one.
+     * @return 'true' if @a a, @a b, @a c turn strictly in the
+     * orientation of the vertices of the chosen chain.
+     */
+    bool isStrictTurn( const Point & a, const Point & b, const Point & c,
+                       bool upper ) const;
+
+    /**
+     * Inserts a point in a chain and removes its neighbours that are
+     * no more vertices.
+     * @param chain the lower or upper chain.
+     * @param aPoint the new point.
+     * @param upper 'true' if @a chain is the upper chain.
+     * @return 'true' if @a aPoint is a vertex of @a chain.
+     */
+    bool addToChain( Chain & chain, const Point & aPoint, bool upper );
+
+    /**
+     * @param chain the lower or upper chain.
+     * @param aPoint any point.
+     * @param upper 'true' if @a chain is the upper chain.
+     * @return 'true' if @a aPoint lies on the inner side of @a chain
+     * or on it.
+     */
+    bool isInsideChain( const Chain & chain, const Point & aPoint,
+                        bool upper ) const;
+
+  }; // end of class DynamicConvexHull2D
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'DynamicConvexHull2D'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'DynamicConvexHull2D' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TPoint, typename TOrientationFunctor>
+  std::ostream&
+  operator<< ( std::ostream & out, const DynamicConvexHull2D<TPoint, TOrientationFunctor> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/tools/DynamicConvexHull2D.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined DynamicConvexHull2D_h
+
+#undef DynamicConvexHull2D_RECURSES
+#endif // else defined(DynamicConvexHull2D_RECURSES)
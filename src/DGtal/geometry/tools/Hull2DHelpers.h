@@ -357,6 +357,43 @@ namespace DGtal
 				   OutputIterator res, 
 				   const Predicate& aPredicate ); 
 
+    /**
+     * @brief Procedure that retrieves the vertices of the hull of a
+     * large unsorted set of 2D points given by the range
+     * [ @a itb , @a ite ), by divide and conquer.
+     * - first, the points are split into @a nbChunks chunks, whose
+     * hulls are computed concurrently by the monotone-chain algorithm
+     * (with OpenMP, when available).
+     * - then, the hull of the union of the vertices of these hulls,
+     * which is the hull of the whole set, is computed the same way.
+     * @see Hull2D::andrewConvexHullAlgorithm
+     *
+     * @post The output is the same as andrewConvexHullAlgorithm with a
+     * predicate returning 'true' for strictly positive orientations,
+     * i.e. the vertices are given counterclockwise for usual
+     * orientation functors.
+     *
+     * @param itb begin iterator
+     * @param ite end iterator
+     * @param res output iterator used to export the retrieved points
+     * @param aFunctor an orientation functor, copied in each chunk,
+     * since orientation functors are stateful.
+     * @param nbChunks the number of chunks, or 0 to choose it
+     * from the number of points.
+     *
+     * @tparam ForwardIterator a model of forward and readable iterator
+     * @tparam OutputIterator a model of incrementable and writable iterator
+     * @tparam Functor a model of COrientationFunctor2
+     */
+    template <typename ForwardIterator,
+              typename OutputIterator,
+              typename Functor >
+    void parallelConvexHullAlgorithm(const ForwardIterator& itb,
+                                     const ForwardIterator& ite,
+                                     OutputIterator res,
+                                     const Functor& aFunctor,
+                                     unsigned int nbChunks = 0 );
+
 
     /**
      *  @brief Procedure to compute the convex hull thickness given
@@ -0,0 +1,356 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file RayIntersectionBVH.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module RayIntersectionBVH.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(RayIntersectionBVH_RECURSES)
+#error Recursive header files inclusion detected in RayIntersectionBVH.h
+#else // defined(RayIntersectionBVH_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define RayIntersectionBVH_RECURSES
+
+#if !defined RayIntersectionBVH_h
+/** Prevents repeated inclusion of headers. */
+#define RayIntersectionBVH_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <limits>
+#include "DGtal/base/Common.h"
+#include "DGtal/shapes/Mesh.h"
+#include "DGtal/shapes/TriangulatedSurface.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class RayIntersectionBVH
+  /**
+   * Description of template class 'RayIntersectionBVH' <p>
+   * \brief Aim: A bounding volume hierarchy over triangles, quads,
+   * mesh faces or surfels in dimension 3, which accelerates the ray
+   * queries of RayIntersectionPredicate (closest intersection,
+   * occlusion, number of intersections).
+   *
+   * Primitives are added with their index (e.g. the index of the
+   * face in a Mesh or TriangulatedSurface, or the position of the
+   * surfel in a range), then the hierarchy is built by \ref build.
+   * Polygonal faces are split into triangles, which are stored by
+   * coordinates (structure of arrays) in the order of the leaves of
+   * the hierarchy. Nodes are split at the median of the centroids
+   * along their largest axis.
+   *
+   * Rays are traversed by packets of \ref PACKET_SIZE rays, and each
+   * box or triangle is tested against all the rays of the packet in
+   * a loop that compilers vectorize. Batch queries process packets
+   * concurrently (OpenMP). As for RayIntersectionPredicate, triangles
+   * are closed and a ray starting on a triangle intersects it, except
+   * for counting queries (countIntersections, isInside, areInside)
+   * which use half-open edges.
+   *
+   * Surfels are given in Khalimsky coordinates, like in
+   * RayIntersectionPredicate: a surfel (i,j,k) with i even is the quad
+   * (i,j+/-1,k+/-1).
+   *
+   * @code
+   * RayIntersectionBVH< Z3i::RealPoint > bvh;
+   * bvh.addSurfels( surface.begin(), surface.end() );
+   * bvh.build();
+   * auto hits = bvh.closestIntersections( origins, directions );
+   * @endcode
+   *
+   * @tparam TRealPoint a type of real points in dimension 3, e.g. Z3i::RealPoint.
+   */
+  template <typename TRealPoint>
+  class RayIntersectionBVH
+  {
+    BOOST_STATIC_ASSERT( TRealPoint::dimension == 3 );
+
+  public:
+    typedef RayIntersectionBVH<TRealPoint>   Self;
+    typedef TRealPoint                       RealPoint;
+    typedef TRealPoint                       RealVector;
+    typedef typename RealPoint::Component    Scalar;
+    typedef std::vector< RealPoint >         RealPoints;
+    typedef std::vector< RealVector >        RealVectors;
+    typedef std::vector< Scalar >            Scalars;
+    typedef std::size_t                      Index;
+    typedef std::size_t                      Size;
+
+    /// The number of rays traversed together.
+    static const Size  PACKET_SIZE = 8;
+    /// The maximal number of triangles in a leaf.
+    static const Size  MAX_LEAF_SIZE = 4;
+    /// Index of no primitive.
+    static const Index INVALID_INDEX = static_cast< Index >( -1 );
+
+    /// The result of a closest intersection query.
+    struct Intersection {
+      /// The index of the intersected primitive, or INVALID_INDEX.
+      Index  primitive;
+      /// The ray parameter of the intersection, i.e. its distance to
+      /// the origin in units of the ray direction.
+      Scalar distance;
+
+      Intersection()
+        : primitive( INVALID_INDEX ),
+          distance( std::numeric_limits< Scalar >::infinity() ) {}
+      /// @return 'true' iff the ray intersects a primitive.
+      bool isValid() const { return primitive != INVALID_INDEX; }
+    };
+    typedef std::vector< Intersection >      Intersections;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /// Default constructor. The hierarchy is empty.
+    RayIntersectionBVH();
+
+    /// Removes all primitives.
+    void clear();
+
+    /// Adds a triangle.
+    /// @param a,b,c the vertices of the triangle.
+    /// @param index the index of the primitive.
+    void addTriangle( const RealPoint& a, const RealPoint& b, const RealPoint& c,
+                      Index index );
+
+    /// Adds a quad, as the two triangles (a,b,c) and (a,c,d) like
+    /// RayIntersectionPredicate.
+    /// @param a,b,c,d the vertices of the quad.
+    /// @param index the index of the primitive.
+    void addQuad( const RealPoint& a, const RealPoint& b,
+                  const RealPoint& c, const RealPoint& d,
+                  Index index );
+
+    /// Adds the faces of a mesh, each face being triangulated as a
+    /// fan. The index of a primitive is the index of its face.
+    /// @param mesh any mesh.
+    template <typename TPoint>
+    void addMesh( const Mesh< TPoint >& mesh );
+
+    /// Adds the faces of a triangulated surface. The index of a
+    /// primitive is the index of its face.
+    /// @param surface any triangulated surface.
+    template <typename TPoint>
+    void addTriangulatedSurface( const TriangulatedSurface< TPoint >& surface );
+
+    /// Adds a range of surfels as quads in Khalimsky coordinates. The
+    /// index of a primitive is the position of its surfel in the range.
+    /// @param itb,ite a range of (signed or unsigned) 2-cells of a 3D Khalimsky space.
+    template <typename TSurfelIterator>
+    void addSurfels( TSurfelIterator itb, TSurfelIterator ite );
+
+    /// Builds the hierarchy over the added primitives. It must be
+    /// called before any query.
+    void build();
+
+    /// @return the number of triangles.
+    Size nbTriangles() const;
+
+    /// @return the number of nodes of the hierarchy.
+    Size nbNodes() const;
+
+    // ----------------------- Ray queries ------------------------------------
+  public:
+
+    /// @param origin the origin of the ray.
+    /// @param direction the (non null) direction of the ray.
+    /// @param tmax the maximal ray parameter.
+    /// @return the closest intersection of the ray with a primitive,
+    /// if any, with a parameter in [0,tmax].
+    Intersection closestIntersection
+    ( const RealPoint& origin, const RealVector& direction,
+      Scalar tmax = std::numeric_limits< Scalar >::infinity() ) const;
+
+    /// @param origin the origin of the ray.
+    /// @param direction the (non null) direction of the ray.
+    /// @param tmax the maximal ray parameter.
+    /// @return 'true' iff the ray intersects a primitive with a
+    /// parameter in [0,tmax], which stops at the first found intersection.
+    bool intersects
+    ( const RealPoint& origin, const RealVector& direction,
+      Scalar tmax = std::numeric_limits< Scalar >::infinity() ) const;
+
+    /// Counts the crossings of a ray with the triangles. Contrary to
+    /// the other queries, edges are half-open: a ray through an edge
+    /// shared by two triangles (e.g. the diagonal of a quad) crosses
+    /// only one of them, so that the parity of the count is correct.
+    /// A ray through a vertex may still be miscounted.
+    /// @param origin the origin of the ray.
+    /// @param direction the (non null) direction of the ray.
+    /// @return the number of crossings of the ray with the triangles.
+    Size countIntersections( const RealPoint& origin, const RealVector& direction ) const;
+
+    /// Inside/outside test by the parity of the number of
+    /// intersections along a fixed generic direction.
+    /// @pre the primitives form a closed surface.
+    /// @param p any point not on the surface.
+    /// @return 'true' iff \a p is inside the surface.
+    bool isInside( const RealPoint& p ) const;
+
+    /// Closest intersections of many rays, computed by packets in parallel.
+    /// @param origins the origins of the rays.
+    /// @param directions the directions of the rays (same size as \a origins).
+    /// @param tmax the maximal ray parameter.
+    /// @return the closest intersection of each ray.
+    Intersections closestIntersections
+    ( const RealPoints& origins, const RealVectors& directions,
+      Scalar tmax = std::numeric_limits< Scalar >::infinity() ) const;
+
+    /// Occlusion of many rays (e.g. visibility between points),
+    /// computed by packets in parallel.
+    /// @param origins the origins of the rays.
+    /// @param directions the directions of the rays (same size as \a origins).
+    /// @param tmax the maximal ray parameter.
+    /// @return for each ray, 'true' iff it intersects a primitive within [0,tmax].
+    std::vector< bool > intersects
+    ( const RealPoints& origins, const RealVectors& directions,
+      Scalar tmax = std::numeric_limits< Scalar >::infinity() ) const;
+
+    /// Inside/outside tests of many points, computed in parallel.
+    /// @pre the primitives form a closed surface.
+    /// @param points any points not on the surface.
+    /// @return for each point, 'true' iff it is inside the surface.
+    std::vector< bool > areInside( const RealPoints& points ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the hierarchy is built over the current primitives.
+     */
+    bool isValid() const;
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+
+    /// A node of the hierarchy. The left child of an inner node
+    /// follows it, its right child is at index \a first.
+    struct Node {
+      Scalar lo[ 3 ];  ///< lower corner of the bounding box
+      Scalar up[ 3 ];  ///< upper corner of the bounding box
+      Index  first;    ///< first triangle (leaf) or right child (inner node)
+      Size   count;    ///< number of triangles (leaf) or 0 (inner node)
+      Dimension axis;  ///< split axis (inner node)
+    };
+
+    /// A packet of rays, stored by coordinates.
+    struct Packet {
+      Scalar o[ 3 ][ PACKET_SIZE ];   ///< origins
+      Scalar d[ 3 ][ PACKET_SIZE ];   ///< directions
+      Scalar inv[ 3 ][ PACKET_SIZE ]; ///< inverse of directions
+      Scalar tmax[ PACKET_SIZE ];     ///< current maximal parameters (negative if inactive)
+      Index  hit[ PACKET_SIZE ];      ///< current intersected primitives
+      Size   count[ PACKET_SIZE ];    ///< current numbers of intersections
+    };
+
+    /// Triangle vertices, as added (a,b,c coordinates one after the other).
+    Scalars myInput;
+    /// Primitive index of each added triangle.
+    std::vector< Index > myInputIndices;
+    /// The nodes of the hierarchy, root first.
+    std::vector< Node > myNodes;
+    /// First vertex of the triangles in leaf order, by coordinate.
+    Scalars myV0[ 3 ];
+    /// Second vertex of the triangles in leaf order, by coordinate.
+    Scalars myV1[ 3 ];
+    /// Third vertex of the triangles in leaf order, by coordinate.
+    Scalars myV2[ 3 ];
+    /// Primitive index of the triangles in leaf order.
+    std::vector< Index > myIndices;
+    /// Tells if the hierarchy is built over the current primitives.
+    bool myIsBuilt;
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /// Recursively builds the node for the triangles order[b..e).
+    /// @param order triangle indices, reordered in place.
+    /// @param centroids the centroids of the triangles, by coordinate.
+    /// @param b,e the range of triangles.
+    void buildNode( std::vector< Index >& order, const Scalars& centroids,
+                    Index b, Index e );
+
+    /// Initializes a packet with the rays [i,i+n) of the given ranges.
+    void initPacket( Packet& packet, const RealPoints& origins,
+                     const RealVectors& directions, Index i, Size n,
+                     Scalar tmax ) const;
+
+    /// Initializes a packet with a single ray.
+    void initPacket( Packet& packet, const RealPoint& origin,
+                     const RealVector& direction, Scalar tmax ) const;
+
+    /// Traverses the hierarchy with a packet of rays.
+    /// @tparam mode 0: closest intersection, 1: any intersection
+    /// (deactivates the rays that hit), 2: counts all crossings.
+    template < int mode >
+    void traverse( Packet& packet ) const;
+
+    /// Counts the crossings of the rays of a packet with a triangle,
+    /// with half-open edges (see countIntersections).
+    /// @param packet the packet of rays.
+    /// @param j the index of the triangle in leaf order.
+    void countCrossings( Packet& packet, Index j ) const;
+
+  }; // end of class RayIntersectionBVH
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'RayIntersectionBVH'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'RayIntersectionBVH' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TRealPoint>
+  std::ostream&
+  operator<< ( std::ostream & out, const RayIntersectionBVH<TRealPoint> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/tools/RayIntersectionBVH.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined RayIntersectionBVH_h
+
+#undef RayIntersectionBVH_RECURSES
+#endif // else defined(RayIntersectionBVH_RECURSES)
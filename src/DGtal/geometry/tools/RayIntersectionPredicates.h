@@ -74,6 +74,8 @@ namespace DGtal
    *   Surface::ConstIterator it = std::find_if(surface.begin(), surface.end(), rayPredicateInstance);
    * @endcode
    *
+   * To intersect many rays with large surfaces, see RayIntersectionBVH.
+   *
    * @tparam TPoint type of points.  
    *
    */
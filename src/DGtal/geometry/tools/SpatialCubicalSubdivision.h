@@ -42,8 +42,10 @@
 // Inclusions
 #include <iostream>
 #include <vector>
+#include <unordered_map>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/Clone.h"
+#include "DGtal/kernel/PointHashFunctions.h"
 #include "DGtal/images/ImageContainerBySTLVector.h"
 //////////////////////////////////////////////////////////////////////////////
 
@@ -63,6 +65,11 @@ namespace DGtal
 
      Bins are characterized by one Point and are organized as a
      rectangular domain with lowest bin at coordinates (0,...,0).
+
+     By default, bins are stored in an image over the whole domain of
+     bins. In sparse mode, only non-empty bins are stored (in a hash
+     map), which is preferable when points are sparse within a large
+     domain.
      
      @tparam TSpace the digital space, a model of CSpace.
 
@@ -80,6 +87,7 @@ namespace DGtal
     typedef HyperRectDomain<Space> Domain;
     typedef std::vector<Point> Storage;
     typedef ImageContainerBySTLVector<Domain,Storage*> StorageArray;
+    typedef std::unordered_map<Point,Storage> SparseStorageArray;
     typedef typename StorageArray::ConstRange BinConstRange;
 
     // ----------------------- Standard services ------------------------------
@@ -102,8 +110,13 @@ namespace DGtal
        @param lo the lowest point of the domain of interest.
        @param up the uppermost point of the domain of interest.
        @param size the edge size of each cubical bin (an integer >= 2 ).
+       @param sparse when 'true', only non-empty bins are stored.
     */
-    SpatialCubicalSubdivision( Point lo, Point up, Coordinate size );
+    SpatialCubicalSubdivision( Point lo, Point up, Coordinate size,
+                               bool sparse = false );
+
+    /// @return 'true' iff only non-empty bins are stored.
+    bool isSparse() const;
 
     /// @return the rectangular domain of interest
     const Domain& domain() const;
@@ -197,9 +210,16 @@ namespace DGtal
     Domain myDomain;
     /// the edge size of each bin.
     Coordinate mySize;
+    /// the domain of bins.
+    Domain myBinDomain;
     /// the image that associates to each bin its dyn. allocated
     /// vector of points. If 0, no point is stored in this bin.
+    /// Unused in sparse mode.
     StorageArray myArray;
+    /// tells if only non-empty bins are stored.
+    bool mySparse;
+    /// the non-empty bins, in sparse mode.
+    SparseStorageArray mySparseArray;
     // ------------------------- Private Datas --------------------------------
   private:
     /// a precomputed point to improve performance of uppermost() method.
@@ -207,6 +227,11 @@ namespace DGtal
 
     // ------------------------- Hidden services ------------------------------
   protected:
+    /**
+       @param b any valid bin of binDomain().
+       @return the points of bin \a b, or 0 if there is none.
+    */
+    const Storage* binStorage( const Point & b ) const;
 
     // ------------------------- Internals ------------------------------------
   private:
@@ -41,11 +41,13 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/ConstAlias.h"
 #include "DGtal/base/Clone.h"
 #include "DGtal/kernel/sets/CDigitalSet.h"
 #include "DGtal/kernel/sets/DigitalSetBySTLSet.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
 #include "DGtal/geometry/volumes/distance/DistanceTransformation.h"
 #include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
 #include "DGtal/kernel/BasicPointPredicates.h"
@@ -74,6 +76,13 @@ namespace DGtal
    * Eucliean metric (the distance is computed on both true and false points from the point
    * predicate in the given domain).
    *
+   * The random number attached to a point only depends on a seed and
+   * on the index of the point in the domain (counter-based generator),
+   * hence the noise can be computed concurrently (with OpenMP) and the
+   * result does not depend on the number of threads. The static method
+   * noisify() writes the noisy object directly into an image (e.g. a
+   * binary image), without building the digital set.
+   *
    * @tparam TPointPredicate any model of point predicate concept (concepts::CPointPredicate)
    * @tparam TDomain any model of CDomain
    * @tparam TDigitalSetContainer container type to store the point predicate (default: DigitalSetBySTLSet)
@@ -111,10 +120,12 @@ namespace DGtal
      * @param aPredicate input point predicate defining the input objects.
      * @param aDomain domain used for the distance transformation computation.
      * @param anAlpha noise parameter between ]0,1[.
+     * @param aSeed seed of the random generator.
      */
     KanungoNoise(ConstAlias<PointPredicate> aPredicate,
                  ConstAlias<Domain> aDomain,
-                 const double anAlpha);
+                 const double anAlpha,
+                 const DGtal::uint64_t aSeed = 0);
      
     /**
      * Destructor.
@@ -129,6 +140,34 @@ namespace DGtal
      */
     KanungoNoise & operator= ( const KanungoNoise & other );
     
+    // ----------------------- Static services ------------------------------
+  public:
+
+    /**
+     * Computes the noisy version of a point predicate and writes it
+     * into an image: the value of each point of [aDomain] is set to
+     * true if the point belongs to the noisy object, false otherwise.
+     * The result is the same as the one of the KanungoNoise predicate
+     * built with the same parameters.
+     *
+     * @note The predicate is entirely evaluated before the image is
+     * written, hence @a anImage may be the input predicate itself.
+     *
+     * @param anImage the output image (its domain must contain aDomain).
+     * @param aPredicate input point predicate defining the input objects.
+     * @param aDomain domain used for the distance transformation computation.
+     * @param anAlpha noise parameter between ]0,1[.
+     * @param aSeed seed of the random generator.
+     *
+     * @tparam TImage a model of CImage with a value type constructible from bool.
+     */
+    template <typename TImage>
+    static void noisify( TImage & anImage,
+                         const PointPredicate & aPredicate,
+                         const Domain & aDomain,
+                         const double anAlpha,
+                         const DGtal::uint64_t aSeed = 0 );
+
     // ----------------------- Interface --------------------------------------
   public:
 
@@ -174,6 +213,36 @@ namespace DGtal
 
        // ------------------------- Internals ------------------------------------
   private:
+
+    /**
+     * Computes the noisy object: the i-th point of [aDomain] (in the
+     * domain scanning order) belongs to the noisy object iff
+     * inside[i] is non-zero. The domain is processed slab by slab
+     * (slices orthogonal to the last axis), concurrently with OpenMP.
+     *
+     * @param aPredicate input point predicate defining the input objects.
+     * @param aDomain domain used for the distance transformation computation.
+     * @param anAlpha noise parameter between ]0,1[.
+     * @param aSeed seed of the random generator.
+     * @param[out] inside the noisy object, resized to aDomain.size().
+     */
+    static void computeNoise( const PointPredicate & aPredicate,
+                              const Domain & aDomain,
+                              const double anAlpha,
+                              const DGtal::uint64_t aSeed,
+                              std::vector<unsigned char> & inside );
+
+    /**
+     * Counter-based random generator.
+     *
+     * @param aSeed the seed.
+     * @param anIndex the counter (index of a point in the domain).
+     * @return a pseudo-random number in [0,1) uniquely determined by
+     * the pair (aSeed, anIndex).
+     */
+    static double uniformRandom( const DGtal::uint64_t aSeed,
+                                 const DGtal::uint64_t anIndex );
+
     ///Pointeur to the object
     const PointPredicate &myPredicate;
     
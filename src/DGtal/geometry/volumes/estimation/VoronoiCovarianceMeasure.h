@@ -42,6 +42,9 @@
 // Inclusions
 #include <cmath>
 #include <iostream>
+#include <vector>
+#include <map>
+#include <mutex>
 #include "DGtal/base/Common.h"
 #include "DGtal/math/BasicMathFunctions.h"
 #include "DGtal/kernel/BasicPointPredicates.h"
@@ -65,7 +68,20 @@ namespace DGtal
    * arbitrary function with given support.
    *
    * You may obtain the whole sequence (Point,VCM) by accessing the
-   * map \ref vcmMap.
+   * map \ref vcmMap, or the vectors \ref points and \ref matrices.
+   *
+   * By default, the closest site of each point of the computation
+   * domain is given by a Voronoi map computed over the whole bounding
+   * domain of the input points. In sparse mode, the Voronoi map is
+   * not computed over the whole domain: the domain is cut into cubical
+   * tiles, and only the tiles intersecting the R-offset of the input
+   * points are visited (concurrently if DGtal is built with OpenMP),
+   * each one with a Voronoi map restricted to its R-neighborhood. The
+   * sites of a tile are given by the proximity structure, whose bins
+   * are then stored sparsely. Sparse mode is much lighter for sparse
+   * point clouds with a large bounding box. Both modes give the same
+   * result, except for points equidistant to several sites, which may
+   * be attributed to another site.
    *
    * @note Documentation in \ref moduleVCM_sec2.
    *
@@ -120,6 +136,7 @@ namespace DGtal
                                  Space::dimension > MatrixNN; ///< the type for nxn matrix of real numbers.
     typedef typename MatrixNN::RowVector VectorN;             ///< the type for N-vector of real numbers
     typedef std::vector<Point> PointContainer;                ///< the list of points
+    typedef std::vector<MatrixNN> MatrixContainer;            ///< the list of matrices
     typedef std::map<Point,MatrixNN> Point2MatrixNN;          ///< Associates a matrix to points.
 
     // ----------------------- Standard services ------------------------------
@@ -139,8 +156,11 @@ namespace DGtal
      *
      * @param aMetric an instance of the metric.
      * @param verbose if 'true' displays information on ongoing computation.
+     * @param sparse if 'true', the Voronoi map is only computed
+     * around the input points (see \ref VoronoiCovarianceMeasure).
      */
-    VoronoiCovarianceMeasure( double _R, double _r, Metric aMetric = Metric(), bool verbose = false );
+    VoronoiCovarianceMeasure( double _R, double _r, Metric aMetric = Metric(), bool verbose = false,
+                              bool sparse = false );
 
     /**
      * Destructor.
@@ -175,15 +195,27 @@ namespace DGtal
     /// @return the domain of computation
     const Domain& domain() const;
 
+    /// @return 'true' iff the sparse mode is used.
+    bool isSparse() const;
+
     /// @return the current Voronoi map 
-    /// @pre init must have been called before.
+    /// @pre init must have been called before, not in sparse mode.
     const Voronoi& voronoiMap() const;
 
     /// @return the Voronoi Covariance Matrix of each Voronoi cell as
     /// a map Point -> Matrix
     /// @note empty if \ref init has not been called.
+    /// @note the map is built at the first call after \ref init,
+    /// under a lock, so concurrent calls on a const object are safe.
     const Point2MatrixNN& vcmMap() const;
 
+    /// @return the (sorted) input points, i.e. the sites of the Voronoi cells.
+    const PointContainer& points() const;
+
+    /// @return the Voronoi Covariance Matrix of each Voronoi cell,
+    /// the i-th matrix corresponding to the i-th point of \ref points.
+    const MatrixContainer& matrices() const;
+
     /**
     Computes the Voronoi Covariance Measure of the function \a chi_r.
     
@@ -200,6 +232,23 @@ namespace DGtal
     template <typename Point2ScalarFunction>
     MatrixNN measure( Point2ScalarFunction chi_r, Point p ) const;
 
+    /**
+    Computes the Voronoi Covariance Measure of the function \a chi_r
+    moved at each point of the range [itb,ite), concurrently if DGtal
+    is built with OpenMP.
+    @tparam Point2ScalarFunction the type of a functor Point->Scalar.
+    @tparam PointInputIterator an input iterator on digital points.
+    @param chi_r the kernel function whose support is included in
+    the cube centered on the origin with edge size 2r.
+    @param itb the start of the range of points (within domain).
+    @param ite the end of the range of points.
+    @param[out] result the i-th matrix is the measure at the i-th point of the range.
+    */
+    template <typename Point2ScalarFunction, typename PointInputIterator>
+    void measure( Point2ScalarFunction chi_r, 
+                  PointInputIterator itb, PointInputIterator ite,
+                  MatrixContainer & result ) const;
+
     // ----------------------- Interface --------------------------------------
   public:
 
@@ -229,14 +278,22 @@ namespace DGtal
     Metric myMetric;
     /// Tells if it is verbose mode.
     bool myVerbose;
+    /// Tells if it is sparse mode.
+    bool mySparse;
     /// The domain in which all computations are done.
     Domain myDomain;
     /// A binary image that defines the characteristic set of K.
     CharacteristicSet* myCharSet;
     /// Stores the voronoi map.
     Voronoi* myVoronoi;
-    /// The map point -> VCM
-    Point2MatrixNN myVCM;
+    /// The sorted input points (sites).
+    PointContainer myPoints;
+    /// The VCM of each site, in the same order as myPoints.
+    MatrixContainer myMatrices;
+    /// The map point -> VCM, built on demand by vcmMap().
+    mutable Point2MatrixNN myVCM;
+    /// Guards the lazy construction of myVCM.
+    mutable std::mutex myVCMMutex;
     /// The structure used for proximity queries.
     ProximityStructure* myProximityStructure;
 
@@ -268,7 +325,26 @@ namespace DGtal
 
     // ------------------------- Internals ------------------------------------
   private:
+    /**
+       @param p any input point.
+       @return the index of \a p in myPoints.
+    */
+    Size index( const Point & p ) const;
+
+    /// Accumulates the VCM of each site from the Voronoi map computed
+    /// over the whole domain.
+    void computeDenseVCM();
 
+    /// Accumulates the VCM of each site from local Voronoi maps
+    /// computed over the tiles intersecting the R-offset of the sites.
+    void computeSparseVCM();
+
+    /**
+       Adds the tensor product \f$ v^t v \f$ to \a m.
+       @param m any matrix.
+       @param v any vector.
+    */
+    static void addTensor( MatrixNN & m, const VectorN & v );
   }; // end of class VoronoiCovarianceMeasure
 
 
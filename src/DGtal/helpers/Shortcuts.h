@@ -46,6 +46,9 @@
 #include <sstream>
 #include <iterator>
 #include <string>
+#include <algorithm>
+#include <cctype>
+#include <array>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CountedPtr.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
@@ -57,8 +60,10 @@
 #include <DGtal/images/ImageLinearCellEmbedder.h>
 #include "DGtal/shapes/implicit/ImplicitPolynomial3Shape.h"
 #include "DGtal/shapes/GaussDigitizer.h"
+#include "DGtal/shapes/Shapes.h"
 #include "DGtal/shapes/ShapeGeometricFunctors.h"
 #include "DGtal/shapes/MeshHelpers.h"
+#include "DGtal/shapes/MarchingCubes.h"
 #include "DGtal/topology/CCellularGridSpaceND.h"
 #include "DGtal/topology/LightImplicitDigitalSurface.h"
 #include "DGtal/topology/SetOfSurfels.h"
@@ -175,6 +180,9 @@ namespace DGtal
       typedef std::vector< Scalar >                               Scalars;
       typedef std::vector< RealVector >                           RealVectors;
       typedef std::vector< RealPoint >                            RealPoints;
+      /// Structure-of-arrays layout of RealVectors or RealPoints: one
+      /// contiguous array of scalars per coordinate.
+      typedef std::array< Scalars, KSpace::dimension >            RealVectorsSoA;
       typedef IdxVertex                                           Idx;
       typedef std::vector< IdxVertex >                            IdxRange;
 
@@ -595,20 +603,12 @@ namespace DGtal
       {
         const Scalar noise        = params[ "noise"  ].as<Scalar>();
         CountedPtr<BinaryImage> img ( new BinaryImage( shapeDomain ) );
-        if ( noise <= 0.0 )
+        Shapes<Domain>::imageShaper( *img, *shape_digitization, true, false );
+        if ( noise > 0.0 )
           {
-            std::transform( shapeDomain.begin(), shapeDomain.end(),
-                            img->begin(),
-                            [&shape_digitization]
-                            ( const Point& p ) { return (*shape_digitization)(p); } );
-          }
-        else
-          {
-            typedef KanungoNoise< DigitizedImplicitShape3D, Domain > KanungoPredicate;
-            KanungoPredicate noisy_dshape( *shape_digitization, shapeDomain, noise );
-            std::transform( shapeDomain.begin(), shapeDomain.end(),
-                            img->begin(),
-                            [&noisy_dshape] ( const Point& p ) { return noisy_dshape(p); } );
+            // The digitized shape is noisified in place.
+            typedef KanungoNoise< BinaryImage, Domain > KanungoPredicate;
+            KanungoPredicate::noisify( *img, *img, shapeDomain, noise );
           }
         return img;
       }
@@ -629,10 +629,7 @@ namespace DGtal
         typedef KanungoNoise< BinaryImage, Domain > KanungoPredicate;
         const Domain shapeDomain    = bimage->domain();
         CountedPtr<BinaryImage> img ( new BinaryImage( shapeDomain ) );
-        KanungoPredicate noisy_dshape( *bimage, shapeDomain, noise );
-        std::transform( shapeDomain.begin(), shapeDomain.end(),
-                        img->begin(),
-                        [&noisy_dshape] ( const Point& p ) { return noisy_dshape(p); } );
+        KanungoPredicate::noisify( *img, *bimage, shapeDomain, noise );
         return img;
       }
 
@@ -1290,6 +1287,12 @@ namespace DGtal
       /// Builds an indexed digital surface from a space \a K and an
       /// arbitrary range of surfels.
       ///
+      /// @note The surface is built with
+      /// IndexedDigitalSurface::buildInParallel: vertices are numbered
+      /// in increasing order of surfels and faces in increasing order
+      /// of their pivot, hence face indices differ from the ones given
+      /// by IndexedDigitalSurface::build.
+      ///
       /// @param[in] surfels an arbitrary range of surfels.
       ///
       /// @param[in] K the Khalimsky space whose domain encompasses the given surfels.
@@ -1312,7 +1315,7 @@ namespace DGtal
             ( new ExplicitSurfaceContainer( K, surfAdj, surfels ) );
           CountedPtr<IdxDigitalSurface> ptrSurface
             ( new IdxDigitalSurface() );
-          bool ok = ptrSurface->build( ptrSurfContainer );
+          bool ok = ptrSurface->buildInParallel( ptrSurfContainer );
           if ( !ok )
             trace.warning() << "[Shortcuts::makeIdxDigitalSurface]"
                             << " Error building indexed digital surface." << std::endl;
@@ -1677,6 +1680,12 @@ namespace DGtal
           const Color&                   specular_color = Color::White )
         {
           BOOST_STATIC_ASSERT (( KSpace::dimension == 3 ));
+          const std::string binext = binaryMeshExtension( objfile );
+          if ( binext == "ply" )
+            return savePLY( digsurf, embedder, RealVectors(), Colors(),
+                            normals, diffuse_colors, objfile );
+          if ( binext == "stl" )
+            return saveSTL( digsurf, embedder, normals, objfile );
           std::string mtlfile;
           auto lastindex = objfile.find_last_of(".");
           if ( lastindex == std::string::npos )
@@ -1826,6 +1835,127 @@ namespace DGtal
                           ambient_color, diffuse_color, specular_color );
         }
 
+      /// @param[in] filename any filename.
+      /// @return "ply" or "stl" if \a filename has one of these
+      /// extensions (whatever the case), which are saved as binary
+      /// files by the save functions, otherwise an empty string.
+      static std::string binaryMeshExtension( const std::string& filename )
+      {
+        auto lastindex = filename.find_last_of(".");
+        if ( lastindex == std::string::npos ) return "";
+        std::string ext = filename.substr( lastindex + 1 );
+        std::transform( ext.begin(), ext.end(), ext.begin(),
+                        [] ( unsigned char c ) { return std::tolower( c ); } );
+        return ( ext == "ply" || ext == "stl" ) ? ext : "";
+      }
+
+      /// Outputs a digital surface as a binary PLY file. Vertices are
+      /// the pointels of the surface, numbered as in
+      /// getPointelRange( c2i, digsurf ), and faces are its surfels.
+      ///
+      /// @tparam TDigitalSurfaceContainer any model of concepts::CDigitalSurfaceContainer
+      /// @tparam TCellEmbedder any type for maping Cell -> RealPoint.
+      ///
+      /// @param[in] digsurf the digital surface to output as a PLY file
+      /// @param[in] embedder any map Cell->RealPoint
+      /// @param[in] vertex_normals either empty or the normal vector per pointel.
+      /// @param[in] vertex_colors either empty or the color per pointel.
+      /// @param[in] face_normals either empty or the normal vector per surfel.
+      /// @param[in] face_colors either empty or the color per surfel.
+      /// @param[in] plyfile the output filename.
+      /// @return 'true' if the output stream is good.
+      template <typename TDigitalSurfaceContainer,
+        typename TCellEmbedder>
+        static bool
+        savePLY
+        ( CountedPtr< ::DGtal::DigitalSurface<TDigitalSurfaceContainer> > digsurf,
+          const TCellEmbedder&           embedder,
+          const RealVectors&             vertex_normals,
+          const Colors&                  vertex_colors,
+          const RealVectors&             face_normals,
+          const Colors&                  face_colors,
+          const std::string&             plyfile )
+        {
+          RealPoints      positions;
+          MeshFaceStorage faces;
+          makePointelFaceStorage( digsurf, embedder, positions, faces );
+          std::ofstream output( plyfile.c_str(), std::ios::out | std::ios::binary );
+          bool ok = MeshWriter< RealPoint >::export2PLY
+            ( output, positions.cbegin(), positions.cend(), faces,
+              vertex_normals, vertex_colors, face_normals, face_colors );
+          output.close();
+          return ok;
+        }
+
+      /// Outputs a digital surface as a binary STL file, each surfel
+      /// being cut into two triangles.
+      ///
+      /// @tparam TDigitalSurfaceContainer any model of concepts::CDigitalSurfaceContainer
+      /// @tparam TCellEmbedder any type for maping Cell -> RealPoint.
+      ///
+      /// @param[in] digsurf the digital surface to output as a STL file
+      /// @param[in] embedder any map Cell->RealPoint
+      /// @param[in] face_normals either empty or the normal vector per surfel.
+      /// @param[in] stlfile the output filename.
+      /// @return 'true' if the output stream is good.
+      template <typename TDigitalSurfaceContainer,
+        typename TCellEmbedder>
+        static bool
+        saveSTL
+        ( CountedPtr< ::DGtal::DigitalSurface<TDigitalSurfaceContainer> > digsurf,
+          const TCellEmbedder&           embedder,
+          const RealVectors&             face_normals,
+          const std::string&             stlfile )
+        {
+          RealPoints      positions;
+          MeshFaceStorage faces;
+          makePointelFaceStorage( digsurf, embedder, positions, faces );
+          std::ofstream output( stlfile.c_str(), std::ios::out | std::ios::binary );
+          bool ok = MeshWriter< RealPoint >::export2STL
+            ( output, positions.cbegin(), positions.cend(), faces, face_normals );
+          output.close();
+          return ok;
+        }
+
+      /// Builds the positions of the pointels of a digital surface and
+      /// its faces (one per surfel), as expected by MeshWriter.
+      ///
+      /// @tparam TDigitalSurfaceContainer any model of concepts::CDigitalSurfaceContainer
+      /// @tparam TCellEmbedder any type for maping Cell -> RealPoint.
+      ///
+      /// @param[in]  digsurf the digital surface.
+      /// @param[in]  embedder any map Cell->RealPoint
+      /// @param[out] positions the embedding of each pointel.
+      /// @param[out] faces the pointel indices of each surfel.
+      template <typename TDigitalSurfaceContainer,
+        typename TCellEmbedder>
+        static void
+        makePointelFaceStorage
+        ( CountedPtr< ::DGtal::DigitalSurface<TDigitalSurfaceContainer> > digsurf,
+          const TCellEmbedder&           embedder,
+          RealPoints&                    positions,
+          MeshFaceStorage&               faces )
+        {
+          BOOST_STATIC_ASSERT (( KSpace::dimension == 3 ));
+          const KSpace&     K = refKSpace( digsurf );
+          Cell2Index      c2i;
+          auto       pointels = getPointelRange( c2i, digsurf );
+          positions.clear();
+          positions.reserve( pointels.size() );
+          for ( auto&& pointel : pointels )
+            positions.push_back( embedder( pointel ) );
+          faces.clear();
+          faces.reserve( digsurf->size(), 4 * digsurf->size() );
+          std::vector< MeshFaceStorage::VertexIndex > face;
+          for ( auto&& surfel : *digsurf )
+            {
+              face.clear();
+              for ( auto&& primal_vtx : getPointelRange( K, surfel ) )
+                face.push_back( c2i[ primal_vtx ] );
+              faces.push_back( face.begin(), face.end() );
+            }
+        }
+
 
       /// Outputs any vector field \a vf anchored at \a
       /// positions as an OBJ file and a material MTL file. Optionnaly
@@ -2083,10 +2213,16 @@ namespace DGtal
       /// iso-surface of value "thresholdMin+0.5" in the given 3D
       /// gray-scale image.
       ///
+      /// @note Unless noise is added to the binary image, the surface
+      /// is extracted by streaming the image with MarchingCubes,
+      /// without building the digital surface. Vertices and faces are
+      /// then numbered differently from the surface built with noise.
+      ///
       /// @param[in] gray_scale_image any gray-scale image.
       /// @param[in] params the parameters: 
       ///   - surfelAdjacency[0]: specifies the surfel adjacency (1:ext, 0:int)
       ///   - thresholdMin   [0]: specifies the threshold min (excluded) to define binary shape
+      ///   - thresholdMax [255]: specifies the threshold max (included) to define binary shape
       ///   - gridsizex    [1.0]: specifies the space between points along x.
       ///   - gridsizey    [1.0]: specifies the space between points along y.
       ///   - gridsizez    [1.0]: specifies the space between points along z.
@@ -2099,13 +2235,27 @@ namespace DGtal
                               | parametersBinaryImage()
                               | parametersDigitalSurface() )
       {
-        auto K       = getKSpace( gray_scale_image );
-        auto bimage  = makeBinaryImage( gray_scale_image, params );
-        auto digSurf = makeDigitalSurface( bimage, K, params );
+        auto pPolySurf = CountedPtr<PolygonalSurface>
+          ( new PolygonalSurface ); // acquired
         RealVector gh = { params[ "gridsizex" ].as<double>(),
                           params[ "gridsizey" ].as<double>(),
                           params[ "gridsizez" ].as<double>() };
         double threshold = params[ "thresholdMin" ].as<double>() + 0.5;
+        if ( params[ "noise" ].as<Scalar>() <= 0.0 )
+          { // Streams the image, without building the digital surface.
+            MarchingCubes< GrayScaleImage > mc;
+            mc.init( *gray_scale_image,
+                     params[ "thresholdMin" ].as<int>(),
+                     params[ "thresholdMax" ].as<int>(), threshold,
+                     params[ "surfelAdjacency" ].as<int>(), gh );
+            mc.compute();
+            mc.getPolygonalSurface( *pPolySurf );
+            return pPolySurf;
+          }
+        // The binary image is noisy: builds the digital surface.
+        auto K       = getKSpace( gray_scale_image );
+        auto bimage  = makeBinaryImage( gray_scale_image, params );
+        auto digSurf = makeDigitalSurface( bimage, K, params );
         typedef RegularPointEmbedder<Space>         PointEmbedder;
         typedef ImageLinearCellEmbedder
           < KSpace, GrayScaleImage, PointEmbedder > ImageCellEmbedder;
@@ -2113,8 +2263,6 @@ namespace DGtal
         pembedder.init( gh );
         ImageCellEmbedder cembedder;
         cembedder.init( K, *gray_scale_image, pembedder, threshold );
-        auto pPolySurf = CountedPtr<PolygonalSurface>
-          ( new PolygonalSurface ); // acquired
         Surfel2Index s2i;
         MeshHelpers::digitalSurface2DualPolygonalSurface
           ( *digSurf, cembedder, *pPolySurf, s2i );
@@ -2126,10 +2274,16 @@ namespace DGtal
       /// gray-scale image. Non triangular faces are triangulated by
       /// putting a centroid vertex.
       ///
+      /// @note Unless noise is added to the binary image, the surface
+      /// is extracted by streaming the image with MarchingCubes,
+      /// without building the digital surface. Vertices and faces are
+      /// then numbered differently from the surface built with noise.
+      ///
       /// @param[in] gray_scale_image any gray-scale image.
       /// @param[in] params the parameters:
       ///   - surfelAdjacency[0]: specifies the surfel adjacency (1:ext, 0:int)
       ///   - thresholdMin   [0]: specifies the threshold min (excluded) to define binary shape
+      ///   - thresholdMax [255]: specifies the threshold max (included) to define binary shape
       ///   - gridsizex    [1.0]: specifies the space between points along x.
       ///   - gridsizey    [1.0]: specifies the space between points along y.
       ///   - gridsizez    [1.0]: specifies the space between points along z.
@@ -2142,13 +2296,27 @@ namespace DGtal
                                  | parametersBinaryImage()
                                  | parametersDigitalSurface() )
       {
-        auto K       = getKSpace( gray_scale_image );
-        auto bimage  = makeBinaryImage( gray_scale_image, params );
-        auto digSurf = makeDigitalSurface( bimage, K, params );
+        auto pPolySurf = CountedPtr<TriangulatedSurface>
+          ( new TriangulatedSurface ); // acquired
         RealVector gh = { params[ "gridsizex" ].as<double>(),
                           params[ "gridsizey" ].as<double>(),
                           params[ "gridsizez" ].as<double>() };
         double threshold = params[ "thresholdMin" ].as<double>() + 0.5;
+        if ( params[ "noise" ].as<Scalar>() <= 0.0 )
+          { // Streams the image, without building the digital surface.
+            MarchingCubes< GrayScaleImage > mc;
+            mc.init( *gray_scale_image,
+                     params[ "thresholdMin" ].as<int>(),
+                     params[ "thresholdMax" ].as<int>(), threshold,
+                     params[ "surfelAdjacency" ].as<int>(), gh );
+            mc.compute();
+            mc.getTriangulatedSurface( *pPolySurf );
+            return pPolySurf;
+          }
+        // The binary image is noisy: builds the digital surface.
+        auto K       = getKSpace( gray_scale_image );
+        auto bimage  = makeBinaryImage( gray_scale_image, params );
+        auto digSurf = makeDigitalSurface( bimage, K, params );
         typedef RegularPointEmbedder<Space>         PointEmbedder;
         typedef ImageLinearCellEmbedder
           < KSpace, GrayScaleImage, PointEmbedder > ImageCellEmbedder;
@@ -2156,8 +2324,6 @@ namespace DGtal
         pembedder.init( gh );
         ImageCellEmbedder cembedder;
         cembedder.init( K, *gray_scale_image, pembedder, threshold );
-        auto pPolySurf = CountedPtr<TriangulatedSurface>
-          ( new TriangulatedSurface ); // acquired
         Surfel2Index s2i;
         MeshHelpers::digitalSurface2DualTriangulatedSurface
           ( *digSurf, cembedder, *pPolySurf, s2i );
@@ -2280,6 +2446,8 @@ namespace DGtal
         ( CountedPtr< ::DGtal::PolygonalSurface<TPoint> > polysurf,
           const std::string&                            objfile )
         {
+          if ( ! binaryMeshExtension( objfile ).empty() )
+            return saveOBJ( polysurf, RealVectors(), Colors(), objfile );
           std::ofstream output( objfile.c_str() );
           bool ok = MeshHelpers::exportOBJ( output, *polysurf );
           output.close();
@@ -2298,6 +2466,8 @@ namespace DGtal
         ( CountedPtr< ::DGtal::TriangulatedSurface<TPoint> > trisurf,
           const std::string&                               objfile )
         {
+          if ( ! binaryMeshExtension( objfile ).empty() )
+            return saveOBJ( trisurf, RealVectors(), Colors(), objfile );
           std::ofstream output( objfile.c_str() );
           bool ok = MeshHelpers::exportOBJ( output, *trisurf );
           output.close();
@@ -2327,6 +2497,11 @@ namespace DGtal
           const Color&                   diffuse_color  = Color( 200, 200, 255 ),
           const Color&                   specular_color = Color::White )
         {
+          const std::string binext = binaryMeshExtension( objfile );
+          if ( binext == "ply" )
+            return savePLY( polysurf, RealVectors(), Colors(), normals, diffuse_colors, objfile );
+          if ( binext == "stl" )
+            return saveSTL( polysurf, normals, objfile );
           std::string mtlfile;
           auto lastindex = objfile.find_last_of(".");
           if ( lastindex == std::string::npos )
@@ -2369,6 +2544,11 @@ namespace DGtal
           const Color&                   diffuse_color  = Color( 200, 200, 255 ),
           const Color&                   specular_color = Color::White )
         {
+          const std::string binext = binaryMeshExtension( objfile );
+          if ( binext == "ply" )
+            return savePLY( trisurf, RealVectors(), Colors(), normals, diffuse_colors, objfile );
+          if ( binext == "stl" )
+            return saveSTL( trisurf, normals, objfile );
           std::string mtlfile;
           auto lastindex = objfile.find_last_of(".");
           if ( lastindex == std::string::npos )
@@ -2388,6 +2568,104 @@ namespace DGtal
           return ok;
         }
 
+      /// Outputs a polygonal surface as a binary PLY file (with its
+      /// topology), with optional normals and colors per vertex and
+      /// per face.
+      ///
+      /// @tparam TPoint any model of point
+      /// @param[in] polysurf the polygonal surface to output as a PLY file
+      /// @param[in] vertex_normals either empty or the normal vector per vertex.
+      /// @param[in] vertex_colors either empty or the color per vertex.
+      /// @param[in] face_normals either empty or the normal vector per face.
+      /// @param[in] face_colors either empty or the color per face.
+      /// @param[in] plyfile the output filename.
+      /// @return 'true' if the output stream is good.
+      template <typename TPoint>
+        static bool
+        savePLY
+        ( CountedPtr< ::DGtal::PolygonalSurface<TPoint> > polysurf,
+          const RealVectors&             vertex_normals,
+          const Colors&                  vertex_colors,
+          const RealVectors&             face_normals,
+          const Colors&                  face_colors,
+          const std::string&             plyfile )
+        {
+          std::ofstream output( plyfile.c_str(), std::ios::out | std::ios::binary );
+          bool ok = MeshHelpers::exportPLY( output, *polysurf, vertex_normals,
+                                            vertex_colors, face_normals, face_colors );
+          output.close();
+          return ok;
+        }
+
+      /// Outputs a polygonal surface as a binary STL file.
+      ///
+      /// @tparam TPoint any model of point
+      /// @param[in] polysurf the polygonal surface to output as a STL file
+      /// @param[in] face_normals either empty or the normal vector per face.
+      /// @param[in] stlfile the output filename.
+      /// @return 'true' if the output stream is good.
+      template <typename TPoint>
+        static bool
+        saveSTL
+        ( CountedPtr< ::DGtal::PolygonalSurface<TPoint> > polysurf,
+          const RealVectors&             face_normals,
+          const std::string&             stlfile )
+        {
+          std::ofstream output( stlfile.c_str(), std::ios::out | std::ios::binary );
+          bool ok = MeshHelpers::exportSTL( output, *polysurf, face_normals );
+          output.close();
+          return ok;
+        }
+
+      /// Outputs a triangulated surface as a binary PLY file (with its
+      /// topology), with optional normals and colors per vertex and
+      /// per face.
+      ///
+      /// @tparam TPoint any model of point
+      /// @param[in] trisurf the triangulated surface to output as a PLY file
+      /// @param[in] vertex_normals either empty or the normal vector per vertex.
+      /// @param[in] vertex_colors either empty or the color per vertex.
+      /// @param[in] face_normals either empty or the normal vector per face.
+      /// @param[in] face_colors either empty or the color per face.
+      /// @param[in] plyfile the output filename.
+      /// @return 'true' if the output stream is good.
+      template <typename TPoint>
+        static bool
+        savePLY
+        ( CountedPtr< ::DGtal::TriangulatedSurface<TPoint> > trisurf,
+          const RealVectors&             vertex_normals,
+          const Colors&                  vertex_colors,
+          const RealVectors&             face_normals,
+          const Colors&                  face_colors,
+          const std::string&             plyfile )
+        {
+          std::ofstream output( plyfile.c_str(), std::ios::out | std::ios::binary );
+          bool ok = MeshHelpers::exportPLY( output, *trisurf, vertex_normals,
+                                            vertex_colors, face_normals, face_colors );
+          output.close();
+          return ok;
+        }
+
+      /// Outputs a triangulated surface as a binary STL file.
+      ///
+      /// @tparam TPoint any model of point
+      /// @param[in] trisurf the triangulated surface to output as a STL file
+      /// @param[in] face_normals either empty or the normal vector per face.
+      /// @param[in] stlfile the output filename.
+      /// @return 'true' if the output stream is good.
+      template <typename TPoint>
+        static bool
+        saveSTL
+        ( CountedPtr< ::DGtal::TriangulatedSurface<TPoint> > trisurf,
+          const RealVectors&             face_normals,
+          const std::string&             stlfile )
+        {
+          std::ofstream output( stlfile.c_str(), std::ios::out | std::ios::binary );
+          bool ok = MeshHelpers::exportSTL( output, *trisurf, face_normals );
+          output.close();
+          return ok;
+        }
+
 
     
       // ------------------------------ utilities ------------------------------
@@ -2464,6 +2742,52 @@ namespace DGtal
             result[ i ] = range[ match[ i ] ]; 
           return result;
         }
+
+      /// Converts an array of vectors (or points) to a
+      /// structure-of-arrays, i.e. one contiguous array per
+      /// coordinate, which suits vectorized estimators. This is only a
+      /// copy: no service of Shortcuts or ShortcutsGeometry takes or
+      /// returns this layout.
+      ///
+      /// @param[in] vectors any range of vectors or points.
+      /// @return the coordinates of \a vectors stored coordinate by coordinate.
+      ///
+      /// @see getRealVectors
+      static RealVectorsSoA
+        getRealVectorsSoA( const RealVectors& vectors )
+        {
+          RealVectorsSoA result;
+          for ( auto& c : result ) c.resize( vectors.size() );
+          const Idx n = vectors.size();
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+          for ( Idx i = 0; i < n; i++ )
+            for ( Dimension k = 0; k < KSpace::dimension; k++ )
+              result[ k ][ i ] = vectors[ i ][ k ];
+          return result;
+        }
+
+      /// Converts a structure-of-arrays back to an array of vectors
+      /// (or points).
+      ///
+      /// @param[in] soa one array per coordinate, all of the same size.
+      /// @return the corresponding range of vectors.
+      ///
+      /// @see getRealVectorsSoA
+      static RealVectors
+        getRealVectors( const RealVectorsSoA& soa )
+        {
+          const Idx n = soa[ 0 ].size();
+          RealVectors result( n );
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+          for ( Idx i = 0; i < n; i++ )
+            for ( Dimension k = 0; k < KSpace::dimension; k++ )
+              result[ i ][ k ] = soa[ k ][ i ];
+          return result;
+        }
     
     
       /// @param[in] min the minimum considered value for the colormap.
@@ -52,6 +52,7 @@
 #if defined(WITH_EIGEN)
 #include "DGtal/dec/DiscreteExteriorCalculusFactory.h"
 #include "DGtal/dec/ATSolver2D.h"
+#include "DGtal/dec/GeodesicsInHeat.h"
 #endif // defined(WITH_EIGEN)
 //////////////////////////////////////////////////////////////////////////////
 
@@ -190,7 +191,8 @@ namespace DGtal
       {
         return parametersShapeGeometry()
           | parametersGeometryEstimation()
-          | parametersATApproximation();
+          | parametersATApproximation()
+          | parametersGeodesicDistance();
       }
     
       /// @return the parameters and their default values which are used
@@ -1265,6 +1267,145 @@ namespace DGtal
       
       /// @}
       
+      // --------------------------- Geodesic distance ------------------------------
+      /// @name Geodesic distance services
+      /// @{
+    public:
+
+      /// @return the parameters and their default values which are used
+      /// to compute geodesic distances with the heat method.
+      ///   - heat-enabled [  1  ]: 1 if geodesics in heat are enabled (WITH_EIGEN), 0 otherwise.
+      ///   - heat-time    [  1.0]: the diffusion time, in squared grid units (i.e. independent of gridstep).
+      ///
+      /// @note Requires Eigen linear algebra backend. `Use cmake -DWITH_EIGEN=true ..`
+      static Parameters parametersGeodesicDistance()
+      {
+#if defined(WITH_EIGEN)
+        return Parameters
+          ( "heat-enabled", 1 )
+          ( "heat-time",    1.0 );
+#else // defined(WITH_EIGEN)
+        return Parameters( "heat-enabled", 0 );
+#endif// defined(WITH_EIGEN)
+      }
+
+#if defined(WITH_EIGEN)
+
+      /// The prefactorized heat method service for geodesic distances.
+      typedef GeodesicsInHeat< KSpace > HeatGeodesics;
+
+      /// Given any digital \a surface and a surfel range \a surfels,
+      /// prepares the computation of geodesic distances with the heat
+      /// method: the heat and Poisson systems are factorized once, so
+      /// that each set of sources then costs two back-substitutions.
+      ///
+      /// @tparam TAnyDigitalSurface either kind of DigitalSurface, like ShortcutsGeometry::LightDigitalSurface or ShortcutsGeometry::DigitalSurface.
+      ///
+      /// @param[in] surface the digital surface
+      /// @param[in] surfels the sequence of surfels on which distances
+      /// are computed, which should be surfels of \a surface (a warning
+      /// is issued otherwise).
+      /// @param[in] params the parameters:
+      ///   - verbose   [  1  ]: verbose trace mode 0: silent, 1: verbose.
+      ///   - heat-time [  1.0]: the diffusion time, in squared grid units.
+      ///
+      /// @return a smart pointer on the geodesic distance service.
+      ///
+      /// @see getGeodesicDistances
+      /// @note Requires Eigen linear algebra backend. `Use cmake -DWITH_EIGEN=true ..`
+      template <typename TAnyDigitalSurface>
+      static CountedPtr<HeatGeodesics>
+      makeGeodesicsInHeat( CountedPtr<TAnyDigitalSurface> surface,
+                           const SurfelRange&             surfels,
+                           const Parameters&              params
+                           = parametersGeodesicDistance() | parametersGeometryEstimation() )
+      {
+        int      verbose   = params[ "verbose"   ].as<int>();
+        Scalar   dt        = params[ "heat-time" ].as<Scalar>();
+        const auto & container = surface->container();
+        const auto nb_outside = std::count_if
+          ( surfels.cbegin(), surfels.cend(),
+            [&container] ( const Surfel& s ) { return ! container.isInside( s ); } );
+        if ( nb_outside != 0 )
+          trace.warning() << "[ShortcutsGeometry::makeGeodesicsInHeat] "
+                          << nb_outside << " surfels are not in the surface." << std::endl;
+        typedef DiscreteExteriorCalculusFactory<EigenLinearAlgebraBackend> CalculusFactory;
+        typedef typename HeatGeodesics::Calculus Calculus;
+        CountedPtr<Calculus> calculus( new Calculus
+          ( CalculusFactory::createFromNSCells<2>( surfels.cbegin(), surfels.cend() ) ) );
+        return CountedPtr<HeatGeodesics>( new HeatGeodesics( calculus, dt, verbose ) );
+      }
+
+      /// Given a geodesic distance service built on \a surfels,
+      /// returns the geodesic distances of every surfel to the closest
+      /// surfel of \a sources.
+      ///
+      /// @param[in] heat the geodesic distance service (see makeGeodesicsInHeat).
+      /// @param[in] surfels the sequence of surfels at which distances are returned.
+      /// @param[in] sources the sequence of source surfels.
+      /// @param[in] params the parameters:
+      ///   - gridstep [  1.0]: the gridstep that defines the digitization (often called h).
+      ///
+      /// @return the vector of distances, in the same order as \a surfels.
+      /// @note Requires Eigen linear algebra backend. `Use cmake -DWITH_EIGEN=true ..`
+      static Scalars
+      getGeodesicDistances( CountedPtr<HeatGeodesics> heat,
+                            const SurfelRange&        surfels,
+                            const SurfelRange&        sources,
+                            const Parameters&         params = parametersShapeGeometry() )
+      {
+        return getGeodesicDistances( heat, surfels,
+                                     std::vector< SurfelRange >( 1, sources ),
+                                     params ).front();
+      }
+
+      /// Given a geodesic distance service built on \a surfels,
+      /// returns for each set of sources the geodesic distances of
+      /// every surfel to the closest surfel of this set. Sets of
+      /// sources are processed concurrently when OpenMP is enabled.
+      ///
+      /// @param[in] heat the geodesic distance service (see makeGeodesicsInHeat).
+      /// @param[in] surfels the sequence of surfels at which distances are returned.
+      /// @param[in] source_sets the vector of sequences of source surfels.
+      /// @param[in] params the parameters:
+      ///   - gridstep [  1.0]: the gridstep that defines the digitization (often called h).
+      ///
+      /// @return the vector of distances of each set, in the same order as \a surfels.
+      /// @note Requires Eigen linear algebra backend. `Use cmake -DWITH_EIGEN=true ..`
+      static std::vector< Scalars >
+      getGeodesicDistances( CountedPtr<HeatGeodesics>         heat,
+                            const SurfelRange&                surfels,
+                            const std::vector< SurfelRange >& source_sets,
+                            const Parameters&                 params = parametersShapeGeometry() )
+      {
+        typedef typename HeatGeodesics::Index   Index;
+        typedef typename HeatGeodesics::Indices Indices;
+        const Scalar h = params[ "gridstep" ].as<Scalar>();
+        std::vector< Indices > indices_sets;
+        for ( const auto& sources : source_sets )
+          {
+            Indices indices;
+            for ( const auto& s : sources ) indices.push_back( heat->index( s ) );
+            indices_sets.push_back( indices );
+          }
+        std::vector< Index > surfel_indices;
+        for ( const auto& s : surfels ) surfel_indices.push_back( heat->index( s ) );
+        const auto forms = heat->computeBatch( indices_sets );
+        std::vector< Scalars > distances;
+        for ( const auto& form : forms )
+          {
+            Scalars d( surfels.size() );
+            for ( std::size_t i = 0; i < surfels.size(); ++i )
+              d[ i ] = h * form.myContainer( surfel_indices[ i ] );
+            distances.push_back( d );
+          }
+        return distances;
+      }
+
+#endif // defined(WITH_EIGEN)
+
+      /// @}
+
       // ------------------------- Error measures services -------------------------
       /// @name Error measure services
       /// @{
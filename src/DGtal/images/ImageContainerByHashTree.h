@@ -42,6 +42,8 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
+#include <utility>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CLabel.h"
 #include "DGtal/base/ConstRangeAdapter.h"
@@ -116,6 +118,16 @@ namespace DGtal
    * The method isKeyValid(..) is provided to verify the validity of a
    * key. Note that using this security strongly affects performances.
    *
+   * Nodes are not allocated one by one but in contiguous blocks, and
+   * released nodes are recycled. When the image content is known
+   * beforehand (e.g. a sparse labelled volume), buildFromRange()
+   * builds the whole tree at once from a range of (point, value)
+   * pairs: the points are sorted by Morton key (if they are not
+   * already), homogeneous blocks are collapsed into a single leaf
+   * and the leaves are stored consecutively in Morton order. This is
+   * much faster than calling setValue() for each point, which
+   * restructures the tree for each call.
+   *
    * @tparam TDomain type of domains
    * @tparam TValue type for image values
    * @tparam THashKey  type to store Morton keys
@@ -237,26 +249,26 @@ namespace DGtal
                              const Value defaultValue= NumberTraits<Value>::ZERO);
 
 
-    // TODO
-    // /*
-    //  * Copy contructor.
-    //  *
-    //  * @param other object to copy.
-    //  */
-    // ImageContainerByHashTree(const ImageContainerByHashTree<Domain, Value>& other);
+    /**
+     * Copy contructor.
+     *
+     * @param other object to copy.
+     */
+    ImageContainerByHashTree( const ImageContainerByHashTree & other );
 
-    // /*
-    //  * Assignment.
-    //  *
-    //  * @param other object to copy.
-    //  */
-    // ImageContainerByHashTree(const ImageContainerByHashTree<Domain, Value>& other);
+    /**
+     * Assignment.
+     *
+     * @param other object to copy.
+     * @return a reference on 'this'.
+     */
+    ImageContainerByHashTree & operator=( const ImageContainerByHashTree & other );
 
-    // /*
-    //  * Destructor
-    //  * Free the memory allocated by @a myData
-    //  */
-    // ~ImageContainerByHashTree();
+    /**
+     * Destructor
+     * Free the memory allocated by @a myData
+     */
+    ~ImageContainerByHashTree();
 
 
     /**
@@ -361,6 +373,28 @@ namespace DGtal
      */
     void setValue(const Point& aPoint, const Value object);
 
+    /**
+     * Replaces the content of the image by the values of a range of
+     * (point, value) pairs, other points of the domain getting the
+     * default value given at construction. The tree is built at once
+     * and is minimal: each block whose points all have the same value
+     * is a single leaf.
+     *
+     * The range is expected to be sorted by Morton key (see
+     * getKey()), as given by an iteration over another hash tree or
+     * a Z-order traversal, otherwise it is sorted first. Points
+     * outside the domain are ignored and, if a point appears several
+     * times, its last value is kept. The hash table is enlarged when
+     * the tree has more nodes than the table has lists.
+     *
+     * @tparam TInputIterator a model of input iterator on
+     * std::pair<Point,Value> (or any type with @e first and @e second).
+     * @param itb an iterator on the first pair.
+     * @param ite an iterator after the last pair.
+     */
+    template <typename TInputIterator>
+    void buildFromRange( TInputIterator itb, TInputIterator ite );
+
     /**
      * Returns the size of a dimension (the container represents a
      * line, a square, a cube, etc. depending on the dimmension so no
@@ -685,13 +719,69 @@ namespace DGtal
           //n->setObject(object);
           return n;
         }
-      n = new Node(object, key);
+      return insertNewNode(object, key);
+    }
+
+    /**
+     * Add a Node to the tree, knowing that there is no node for this
+     * key yet.
+     *
+     * @param object a object (value)
+     * @param key a hashtree key
+     * @return a pointer to the new node.
+     */
+    Node* insertNewNode(const Value object, const HashKey key)
+    {
+      Node* n = newNode(object, key);
       HashKey key2 = getIntermediateKey(key);
       n->setNext(myData[key2]);
       myData[key2] = n;
       return n;
     }
 
+    /**
+     * Allocates a node from the blocks of nodes, recycling released
+     * nodes first.
+     *
+     * @param object a object (value)
+     * @param key a hashtree key
+     * @return a pointer to the node (not inserted in the hash table).
+     */
+    Node* newNode(const Value object, const HashKey key);
+
+    /**
+     * Gives a node back to the blocks of nodes.
+     * @param n a node removed from the hash table.
+     */
+    void releaseNode(Node* n);
+
+    /**
+     * Removes all the nodes, the hash table is left empty.
+     */
+    void clearNodes();
+
+    /**
+     * Changes the number of bits of the intermediate hash key, the
+     * nodes are moved to the new hash table.
+     * @param keySize the new number of bits.
+     */
+    void rehash(unsigned int keySize);
+
+    /**
+     * Inserts a copy of all the nodes of @a other (of same key size).
+     * @param other another hash tree.
+     */
+    void copyNodes(const ImageContainerByHashTree & other);
+
+    /**
+     * Recursive part of buildFromRange(): builds the sub-tree of @a
+     * key, at depth @a depth, from the sorted (full depth) keys and
+     * values in [@a itb, @a ite).
+     */
+    void buildSubTree(HashKey key, unsigned int depth,
+                      typename std::vector< std::pair<HashKey, Value> >::const_iterator itb,
+                      typename std::vector< std::pair<HashKey, Value> >::const_iterator ite);
+
   public:
     /**
      * Returns a pointer to the node corresponding to the key. If it
@@ -793,6 +883,30 @@ namespace DGtal
     ///The morton code computer.
     Morton<HashKey, Point> myMorton; // public because Display2DFactory !!!
 
+  protected:
+
+    /**
+     * Number of nodes per block of nodes.
+     */
+    BOOST_STATIC_CONSTANT( std::size_t, NODE_BLOCK_SIZE = 4096 );
+
+    /**
+     * Blocks of nodes (never reallocated, so that nodes keep their
+     * address).
+     */
+    std::vector< std::vector<Node> > myNodeBlocks;
+
+    /**
+     * Released nodes, linked through their next pointer.
+     */
+    Node* myFreeNodes;
+
+    /**
+     * The value of points without value (the value of the root at
+     * construction).
+     */
+    Value myDefaultValue;
+
 
   };
 
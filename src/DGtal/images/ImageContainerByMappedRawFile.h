@@ -0,0 +1,413 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ImageContainerByMappedRawFile.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module ImageContainerByMappedRawFile.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ImageContainerByMappedRawFile_RECURSES)
+#error Recursive header files inclusion detected in ImageContainerByMappedRawFile.h
+#else // defined(ImageContainerByMappedRawFile_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ImageContainerByMappedRawFile_RECURSES
+
+#if !defined ImageContainerByMappedRawFile_h
+/** Prevents repeated inclusion of headers. */
+#define ImageContainerByMappedRawFile_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <vector>
+#include <boost/type_traits/is_arithmetic.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/CowPtr.h"
+#include "DGtal/base/SimpleRandomAccessConstRangeFromPoint.h"
+#include "DGtal/base/SimpleRandomAccessRangeFromPoint.h"
+#include "DGtal/base/CLabel.h"
+#include "DGtal/kernel/domains/CDomain.h"
+#include "DGtal/kernel/SpaceND.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class MappedRawFile
+  /**
+   * Description of class 'MappedRawFile' <p>
+   * \brief Aim: maps a byte interval of a file into memory.
+   *
+   * On POSIX systems, the file is mapped with mmap(2), either shared
+   * and read-only, or private (copy-on-write: pages are copied on
+   * first write, modifications are never written back to the file).
+   * On other systems, the byte interval is read into a heap buffer.
+   *
+   * The mapping is released by the destructor. Instances are meant
+   * to be shared through a CowPtr: a copy holds the mapped bytes in
+   * memory, as a writable private buffer.
+   */
+  class MappedRawFile
+  {
+  public:
+    /**
+     * Maps @a nbBytes bytes of file @a filename starting at @a offset.
+     *
+     * @param filename the name of the file.
+     * @param offset the offset (in bytes) of the first mapped byte.
+     * @param nbBytes the number of mapped bytes.
+     * @param writable if 'true', the mapping is private and writable
+     * (copy-on-write), otherwise it is shared and read-only.
+     *
+     * @throw IOException if the file cannot be opened, is too short
+     * or cannot be mapped.
+     */
+    MappedRawFile( const std::string & filename, std::size_t offset,
+                   std::size_t nbBytes, bool writable );
+
+    /**
+     * Copy constructor. The bytes of @a other are copied into a
+     * writable buffer, so that the copy is independent of the file.
+     *
+     * @param other the object to clone.
+     */
+    MappedRawFile( const MappedRawFile & other );
+
+    /// Destructor. Unmaps the file.
+    ~MappedRawFile();
+
+    /// @return a pointer to the first mapped byte.
+    char * data() const;
+
+    /// @return the number of mapped bytes.
+    std::size_t size() const;
+
+    /// @return 'true' if the memory is writable.
+    bool isWritable() const;
+
+    /// @return 'true' if the bytes are memory mapped (and not copied).
+    bool isMapped() const;
+
+  private:
+    MappedRawFile & operator=( const MappedRawFile & other ) = delete;
+
+    /// Address returned by the mapping (page aligned).
+    void * myBase;
+    /// Length of the mapping.
+    std::size_t myMappedLength;
+    /// First requested byte.
+    char * myData;
+    /// Number of requested bytes.
+    std::size_t mySize;
+    /// Writable mapping.
+    bool myWritable;
+    /// Buffer used when memory mapping is not available.
+    std::vector<char> myBuffer;
+  }; // end of class MappedRawFile
+
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ImageContainerByMappedRawFile
+  /**
+   * Description of template class 'ImageContainerByMappedRawFile' <p>
+   *
+   * Aim: Model of CImage whose values are stored in a raw file mapped
+   * in memory. The raw file stores the values of type @a TValue in
+   * the same order as ImageContainerBySTLVector (Linearizer with
+   * ColMajorStorage, i.e. the order of RawReader and RawWriter),
+   * possibly after a header of a given size.
+   *
+   * Contrary to RawReader, opening an image is immediate whatever its
+   * size: values are loaded by the system when pages are first
+   * accessed, and several processes mapping the same file share the
+   * same page cache. Two modes are available:
+   * - READ_ONLY: the file is shared read-only, only the const
+   *   services (operator(), constRange(), const begin() and end())
+   *   may be used: setValue(), range() and the mutable iterators
+   *   throw an IOException. Read a non-const image through a const
+   *   reference or constRange().
+   * - COPY_ON_WRITE: the image can be modified, modified pages are
+   *   privately copied and the file is never altered.
+   *
+   * If the endianness of the file differs from the one of the host,
+   * values are byte-swapped in place when the image is opened, which
+   * requires the COPY_ON_WRITE mode and a full pass over the values.
+   * Since values are accessed in place, the header size must be a
+   * multiple of the alignment of @a TValue.
+   *
+   * Copies of an image share the same mapping until one of them is
+   * modified: the first call to a mutating service (setValue(),
+   * range(), mutable begin() and end()) on a shared COPY_ON_WRITE
+   * image copies its values into memory (see CowPtr), so that copies
+   * behave as independent images. Mutable iterators obtained before
+   * a copy is made still point to the shared values.
+   *
+   * Example usage:
+   * @code
+   * typedef ImageContainerByMappedRawFile<Z3i::Domain, DGtal::uint16_t> Image;
+   * Image image( "scan.raw", Z3i::Domain( Point(0,0,0), Point(2047,2047,2047) ) );
+   * trace.info() << image( Point( 10, 20, 30 ) ) << std::endl;
+   * @endcode
+   *
+   * @tparam TDomain a HyperRectDomain.
+   * @tparam TValue an arithmetic type, the type of the stored values.
+   *
+   * @see ImageContainerBySTLVector, RawReader, RawWriter
+   * @see testImageContainerByMappedRawFile.cpp
+   */
+  template <typename TDomain, typename TValue>
+  class ImageContainerByMappedRawFile
+  {
+
+  public:
+
+    typedef ImageContainerByMappedRawFile<TDomain, TValue> Self;
+
+    /// domain
+    BOOST_CONCEPT_ASSERT ( ( concepts::CDomain<TDomain> ) );
+    typedef TDomain Domain;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Vector Vector;
+    typedef typename Domain::Integer Integer;
+    typedef typename Domain::Size Size;
+    typedef typename Domain::Dimension Dimension;
+    typedef Point Vertex;
+
+    BOOST_STATIC_CONSTANT( Dimension, dimension = Domain::Space::dimension );
+
+    /// domain should be rectangular
+    BOOST_STATIC_ASSERT ( ( boost::is_same< Domain,
+                            HyperRectDomain< typename Domain::Space > >::value ) );
+
+    /// range of values
+    BOOST_CONCEPT_ASSERT ( ( concepts::CLabel<TValue> ) );
+    BOOST_STATIC_ASSERT ( ( boost::is_arithmetic<TValue>::value ) );
+    typedef TValue Value;
+
+    /// Access modes of the mapped file.
+    enum MappingMode { READ_ONLY, COPY_ON_WRITE };
+
+    /// Byte order of the values in the file.
+    enum Endianness { NATIVE_ENDIAN, LITTLE_ENDIAN_ORDER, BIG_ENDIAN_ORDER };
+
+    /////////////////////////// Iterators ////////////////////
+    typedef Value* Iterator;
+    typedef const Value* ConstIterator;
+    typedef std::reverse_iterator<Iterator> ReverseIterator;
+    typedef std::reverse_iterator<ConstIterator> ConstReverseIterator;
+    typedef std::ptrdiff_t Difference;
+    typedef Iterator OutputIterator;
+    typedef ReverseIterator ReverseOutputIterator;
+
+    /////////////////////////// Ranges  /////////////////////
+    typedef SimpleRandomAccessConstRangeFromPoint<ConstIterator,DistanceFunctorFromPoint<Self> > ConstRange;
+    typedef SimpleRandomAccessRangeFromPoint<ConstIterator,Iterator,DistanceFunctorFromPoint<Self> > Range;
+
+    /////////////////// standard services //////////////////
+
+  public:
+
+    /**
+     * Constructor. Maps the values of the raw file @a filename.
+     *
+     * @param filename the raw file name.
+     * @param aDomain the image domain.
+     * @param aMode the access mode (READ_ONLY or COPY_ON_WRITE).
+     * @param anEndianness the byte order of the values in the file.
+     * @param aHeaderSize the number of bytes to skip at the
+     * beginning of the file.
+     *
+     * @throw IOException if the file cannot be mapped or is smaller
+     * than aHeaderSize + aDomain.size() * sizeof( Value ) bytes, if
+     * aHeaderSize is not a multiple of alignof( Value ), or if the
+     * values must be byte-swapped and aMode is READ_ONLY.
+     */
+    ImageContainerByMappedRawFile( const std::string & filename,
+                                   const Domain & aDomain,
+                                   MappingMode aMode = READ_ONLY,
+                                   Endianness anEndianness = NATIVE_ENDIAN,
+                                   std::size_t aHeaderSize = 0 );
+
+    /**
+     * Destructor. The file is unmapped when the last copy is destroyed.
+     */
+    ~ImageContainerByMappedRawFile();
+
+    /////////////////// Interface //////////////////
+
+    /**
+     * Get the value of an image at a given position given
+     * by a Point.
+     *
+     * @pre the point must be in the domain
+     *
+     * @param aPoint the point.
+     * @return the value at aPoint.
+     */
+    Value operator() ( const Point & aPoint ) const;
+
+    /**
+     * Set a value on an Image at a position specified by a Point.
+     *
+     * @pre @c it must be a point in the image domain.
+     *
+     * @param aPoint the point.
+     * @param aValue the value.
+     * @throw IOException if the image is READ_ONLY.
+     */
+    void setValue ( const Point &aPoint, const Value &aValue );
+
+    /**
+     * @return the domain associated to the image.
+     */
+    const Domain &domain() const;
+
+    /**
+     * @return the domain extension of the image.
+     */
+    Vector extent() const;
+
+    /**
+     * @return the access mode of the mapped file.
+     */
+    MappingMode mode() const;
+
+    /**
+     * @return 'true' if the values are memory mapped, 'false' if
+     * they were copied (platforms without memory mapping).
+     */
+    bool isMapped() const;
+
+    /**
+     * @return the range providing begin and end
+     * iterators to scan the values of image.
+     */
+    ConstRange constRange() const;
+
+    /**
+     * @return the range providing begin and end
+     * iterators to scan the values of image.
+     * @throw IOException if the image is READ_ONLY (use constRange()).
+     */
+    Range range();
+
+    /// @return a pointer to the first value.
+    ConstIterator begin() const;
+    /// @return a pointer after the last value.
+    ConstIterator end() const;
+    /// @return a pointer to the first value.
+    /// @throw IOException if the image is READ_ONLY.
+    Iterator begin();
+    /// @return a pointer after the last value.
+    /// @throw IOException if the image is READ_ONLY.
+    Iterator end();
+
+    /**
+     *  Linearized a point and return the position in the file.
+     * @param aPoint the point to convert to an index
+     * @return the index of @a aPoint in the container
+     */
+    Size linearized ( const Point &aPoint ) const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * @return the validity of the Image
+     */
+    bool isValid() const;
+
+    /**
+     * @return the style name used for drawing this object.
+     */
+    std::string className() const;
+
+    /**
+     * @return 'true' if the host stores values in little-endian order.
+     */
+    static bool isHostLittleEndian();
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Checks that the image may be modified and makes its values
+     * private to this image if they are shared with a copy.
+     * @return a pointer to the first value.
+     * @throw IOException if the image is READ_ONLY.
+     */
+    Value * mutableValues();
+
+    /////////////////// Data members //////////////////
+
+  private:
+
+    ///Image domain
+    Domain myDomain;
+
+    ///Domain extent (stored for linearization efficiency)
+    Vector myExtent;
+
+    ///Access mode.
+    MappingMode myMode;
+
+    ///The mapping, shared by copies until one of them is modified.
+    CowPtr<MappedRawFile> myFile;
+
+    ///Pointer to the first value.
+    Value * myValues;
+
+  }; // end of class ImageContainerByMappedRawFile
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ImageContainerByMappedRawFile'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ImageContainerByMappedRawFile' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TDomain, typename TValue>
+  std::ostream&
+  operator<< ( std::ostream & out, const ImageContainerByMappedRawFile<TDomain, TValue> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/ImageContainerByMappedRawFile.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ImageContainerByMappedRawFile_h
+
+#undef ImageContainerByMappedRawFile_RECURSES
+#endif // else defined(ImageContainerByMappedRawFile_RECURSES)
@@ -56,6 +56,8 @@
 #include "DGtal/images/CImage.h"
 #include "DGtal/base/CQuantity.h"
 #include "DGtal/images/ImageContainerBySTLMap.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
 #include "DGtal/images/SetValueIterator.h"
 #include "DGtal/kernel/sets/DigitalSetFromMap.h"
 #include "DGtal/kernel/sets/CDigitalSet.h"
@@ -204,6 +206,83 @@ namespace DGtal
   template<typename I1, typename I2>
   void imageFromImage(I1& aImg1, const I2& aImg2); 
 
+  namespace detail
+  {
+    /**
+     * Evaluates @a anImage at each point of @a aDomain and writes the
+     * values in @a anOutput, in the linear order of the domain. The
+     * domain is scanned line by line along the first axis, lines being
+     * distributed among threads when @a parallel is true (and OpenMP
+     * is available).
+     *
+     * @param anImage the image to evaluate.
+     * @param aDomain the points where @a anImage is evaluated.
+     * @param anOutput an array of (at least) aDomain.size() values.
+     * @param parallel when 'true', lines are evaluated in parallel.
+     *
+     * @tparam I any model of CConstImage, whose operator() can be called
+     * concurrently when @a parallel is true.
+     * @tparam TSpace any model of CSpace.
+     * @tparam TOutput a type constructible from I::Value.
+     */
+    template<typename I, typename TSpace, typename TOutput>
+    void evaluateScanlines( const I& anImage,
+                            const HyperRectDomain<TSpace>& aDomain,
+                            TOutput* anOutput, bool parallel = true );
+  } // namespace detail
+
+  /**
+   * Evaluates once the values of @a anImage at each point of the
+   * domain of @a aResult and stores them in @a aResult. This is meant
+   * for chains of ConstImageAdapter / ImageAdapter (domain
+   * restrictions, value functors, rigid transformations,
+   * thresholding...): the chain is evaluated once per point, in a
+   * batched pass over the scanlines, instead of at each access by
+   * each consumer. Scanlines are evaluated in parallel when OpenMP is
+   * available.
+   *
+   * @note Each value is still computed by one call to operator() of
+   * the chain, which calls the functors held by the adapters: the
+   * functors are neither fused nor specialized.
+   *
+   * Contrary to imageFromImage, values are computed point by point
+   * with operator(), so the domain of @a aResult may be any subdomain
+   * of the domain of @a anImage.
+   *
+   * @param anImage the image to evaluate.
+   * @param aResult (returns) the image to fill.
+   *
+   * @tparam I any model of CConstImage, whose operator() can be called
+   * concurrently (true for adapters on images and pure functors).
+   * @tparam TDomain a HyperRectDomain.
+   * @tparam TValue a type constructible from I::Value.
+   */
+  template<typename I, typename TDomain, typename TValue>
+  void evaluateInto( const I& anImage,
+                     ImageContainerBySTLVector<TDomain, TValue>& aResult );
+
+  /**
+   * Overload of evaluateInto for boolean images, whose storage
+   * (std::vector<bool>) cannot be written concurrently.
+   *
+   * @param anImage the image to evaluate.
+   * @param aResult (returns) the image to fill.
+   */
+  template<typename I, typename TDomain>
+  void evaluateInto( const I& anImage,
+                     ImageContainerBySTLVector<TDomain, bool>& aResult );
+
+  /**
+   * Materializes @a anImage (typically a chain of adapters) into an
+   * image container with the same domain. See evaluateInto.
+   *
+   * @param anImage the image to evaluate, whose domain is a HyperRectDomain.
+   * @return an image container storing the values of @a anImage.
+   */
+  template<typename I>
+  ImageContainerBySTLVector<typename I::Domain, typename I::Value>
+  evaluateImage( const I& anImage );
+
   /**
    * Insert @a aPoint in @a aSet and if (and only if)
    * @a aPoint is a newly inserted point. 
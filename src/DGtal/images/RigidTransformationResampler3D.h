@@ -0,0 +1,276 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file RigidTransformationResampler3D.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module RigidTransformationResampler3D.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(RigidTransformationResampler3D_RECURSES)
+#error Recursive header files inclusion detected in RigidTransformationResampler3D.h
+#else // defined(RigidTransformationResampler3D_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define RigidTransformationResampler3D_RECURSES
+
+#if !defined RigidTransformationResampler3D_h
+/** Prevents repeated inclusion of headers. */
+#define RigidTransformationResampler3D_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/CSpace.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  /////////////////////////////////////////////////////////////////////////////
+  // Template class RigidTransformationResampler3D
+  /**
+   * Description of template class 'RigidTransformationResampler3D' <p>
+   * \brief Aim: resamples a whole 3D image under a rigid transformation
+   * (rotation around an arbitrary axis followed by a translation).
+   *
+   * The transformation is the one of
+   * functors::ForwardRigidTransformation3D and
+   * functors::BackwardRigidTransformation3D, built from the same
+   * parameters. Instead of evaluating a ConstImageAdapter point by
+   * point, the transformed image is computed directly by backward
+   * mapping: along each scanline of the output domain, the source
+   * position is the affine function \f$ a + i.d \f$ of the index @e i
+   * on the line (@e d being the first column of the backward
+   * rotation), and the part of the line whose source position lies in
+   * the source domain is computed once per line. The inner loop has
+   * thus no domain test and no branch, so that it can be vectorized
+   * by the compiler, and the output is computed slab by slab (z
+   * slices) in parallel when OpenMP is available.
+   *
+   * Two interpolations are available:
+   * - NEAREST: the source value at the rounded position, which gives
+   *   the same image as a ConstImageAdapter with a
+   *   functors::BackwardRigidTransformation3D (up to positions at
+   *   equal distance of two voxels, rounded up here);
+   * - TRILINEAR: trilinear interpolation of the 8 source values
+   *   around the position (values must be convertible to and from
+   *   double, integer values are rounded).
+   *
+   * Points whose source position is outside the source domain get a
+   * default value.
+   *
+   * @code
+   * typedef RigidTransformationResampler3D<Z3i::Space> Resampler;
+   * Resampler resampler( origin, axis, M_PI_4, translation );
+   * Image rotated = resampler.resample( image, Resampler::TRILINEAR );
+   * @endcode
+   *
+   * @tparam TSpace a 3 dimensional space.
+   *
+   * @see RigidTransformation3D.h
+   */
+  template <typename TSpace>
+  class RigidTransformationResampler3D
+  {
+    BOOST_CONCEPT_ASSERT(( concepts::CSpace<TSpace> ));
+    BOOST_STATIC_ASSERT(( TSpace::dimension == 3 ));
+
+    // ----------------------- Types ------------------------------
+  public:
+    typedef TSpace Space;
+    typedef typename Space::Point Point;
+    typedef typename Space::RealPoint RealPoint;
+    typedef typename Space::RealVector RealVector;
+    typedef HyperRectDomain<Space> Domain;
+
+    /// Interpolation of the source values.
+    enum Interpolation { NEAREST, TRILINEAR };
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     * @param aOrigin  the center of rotation.
+     * @param aAxis  the axis of rotation.
+     * @param angle  the angle given in radians.
+     * @param aTranslate  the 3D dimensional vector which represents translation.
+     */
+    RigidTransformationResampler3D( const RealPoint & aOrigin,
+                                    const RealVector & aAxis,
+                                    const double & angle,
+                                    const RealVector & aTranslate );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * @param aPoint any point.
+     * @return the image of @a aPoint by the rigid transformation.
+     */
+    RealPoint forward( const RealPoint & aPoint ) const;
+
+    /**
+     * @param aPoint any point.
+     * @return the point whose image by the rigid transformation is @a aPoint.
+     */
+    RealPoint backward( const RealPoint & aPoint ) const;
+
+    /**
+     * Same bounds as functors::DomainRigidTransformation3D used with a
+     * functors::ForwardRigidTransformation3D.
+     *
+     * @param aDomain any domain.
+     * @return the bounding domain of the rounded images of the
+     * corners of @a aDomain.
+     */
+    Domain transformedDomain( const Domain & aDomain ) const;
+
+    /**
+     * Resamples an image on the bounding domain of its transformation.
+     *
+     * @tparam TValue the type of values.
+     * @param anImage the source image.
+     * @param anInterpolation the interpolation of the source values.
+     * @param aDefaultValue the value of points that are mapped outside the source domain.
+     * @param parallel when 'true', slabs are computed in parallel.
+     * @return the transformed image, whose domain is transformedDomain( anImage.domain() ).
+     */
+    template <typename TValue>
+    ImageContainerBySTLVector<Domain, TValue>
+    resample( const ImageContainerBySTLVector<Domain, TValue> & anImage,
+              Interpolation anInterpolation = NEAREST,
+              const TValue & aDefaultValue = TValue(),
+              bool parallel = true ) const;
+
+    /**
+     * Resamples an image on the domain of a given output image.
+     *
+     * @tparam TValue the type of the source values.
+     * @tparam TOutputValue the type of the output values.
+     * @param anImage the source image.
+     * @param[out] aResult the transformed image, its domain is left unchanged.
+     * @param anInterpolation the interpolation of the source values.
+     * @param aDefaultValue the value of points that are mapped outside the source domain.
+     * @param parallel when 'true', slabs are computed in parallel.
+     */
+    template <typename TValue, typename TOutputValue>
+    void resampleInto( const ImageContainerBySTLVector<Domain, TValue> & anImage,
+                       ImageContainerBySTLVector<Domain, TOutputValue> & aResult,
+                       Interpolation anInterpolation = NEAREST,
+                       const TOutputValue & aDefaultValue = TOutputValue(),
+                       bool parallel = true ) const;
+
+    /**
+     * Overload of resampleInto for boolean images, whose storage
+     * (std::vector<bool>) cannot be written concurrently.
+     *
+     * @tparam TValue the type of the source values.
+     * @param anImage the source image.
+     * @param[out] aResult the transformed image, its domain is left unchanged.
+     * @param anInterpolation the interpolation of the source values.
+     * @param aDefaultValue the value of points that are mapped outside the source domain.
+     * @param parallel when 'true', slabs are computed in parallel.
+     */
+    template <typename TValue>
+    void resampleInto( const ImageContainerBySTLVector<Domain, TValue> & anImage,
+                       ImageContainerBySTLVector<Domain, bool> & aResult,
+                       Interpolation anInterpolation = NEAREST,
+                       bool aDefaultValue = false,
+                       bool parallel = true ) const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Resamples @a anImage on @a aDomain, writing the values in
+     * scanline order in @a anOutput.
+     */
+    template <typename TValue, typename TOutput>
+    void resampleScanlines( const ImageContainerBySTLVector<Domain, TValue> & anImage,
+                            const Domain & aDomain, TOutput* anOutput,
+                            Interpolation anInterpolation,
+                            const TOutput & aDefaultValue,
+                            bool parallel ) const;
+
+    /**
+     * Computes the range [begin,end) of the indices @e i of a line
+     * of @a width points such that each coordinate of the source
+     * position @a u + @e i @a d, relative to the source lower bound,
+     * is in [0, @a bound] (or [0, @a bound[ when @a strict is 'true').
+     */
+    void clipLine( const double u[ 3 ], const double d[ 3 ],
+                   const double bound[ 3 ], bool strict, std::size_t width,
+                   std::size_t & begin, std::size_t & end ) const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// Forward rotation (row major), its transpose is the backward rotation.
+    double myRotation[ 3 ][ 3 ];
+    /// Center of rotation.
+    RealPoint myOrigin;
+    /// Translation.
+    RealVector myTranslation;
+
+  }; // end of class RigidTransformationResampler3D
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'RigidTransformationResampler3D'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'RigidTransformationResampler3D' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TSpace>
+  std::ostream&
+  operator<< ( std::ostream & out, const RigidTransformationResampler3D<TSpace> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/RigidTransformationResampler3D.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined RigidTransformationResampler3D_h
+
+#undef RigidTransformationResampler3D_RECURSES
+#endif // else defined(RigidTransformationResampler3D_RECURSES)
@@ -0,0 +1,292 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file TileCachedImage.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module TileCachedImage.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(TileCachedImage_RECURSES)
+#error Recursive header files inclusion detected in TileCachedImage.h
+#else // defined(TileCachedImage_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define TileCachedImage_RECURSES
+
+#if !defined TileCachedImage_h
+/** Prevents repeated inclusion of headers. */
+#define TileCachedImage_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <atomic>
+#include <memory>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/images/CConstImage.h"
+#include "DGtal/images/DefaultConstImageRange.h"
+#include "DGtal/images/ImageHelper.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  /////////////////////////////////////////////////////////////////////////////
+  // Template class TileCachedImage
+  /**
+   * Description of template class 'TileCachedImage' <p>
+   * \brief Aim: a read-only view on an image (typically a chain of
+   * ConstImageAdapter / ImageAdapter) whose values are computed by
+   * tiles, on demand, and kept in memory.
+   *
+   * The domain is split into hypercubic tiles. The first access to a
+   * point of a tile evaluates the underlying image on the whole tile
+   * (scanline by scanline, see DGtal::evaluateInto), next accesses
+   * read the stored values. This is useful when an expensive adapter
+   * chain is read several times, but only on a part of its domain
+   * (otherwise, DGtal::evaluateImage materializes it at once).
+   *
+   * Several threads may read the same TileCachedImage, provided the
+   * underlying image operator() can be called concurrently: a tile
+   * is published atomically once evaluated (if two threads evaluate
+   * the same tile at the same time, one of the results is dropped).
+   *
+   * TileCachedImage is a model of CConstImage.
+   *
+   * @tparam TImage any model of CConstImage defined on a HyperRectDomain.
+   *
+   * @code
+   * typedef ConstImageAdapter<Image, Domain, functors::Identity, bool, Thresholder> Adapter;
+   * Adapter adapter( image, domain, idD, thresholder );
+   * TileCachedImage<Adapter> cached( adapter, 16 );
+   * bool b = cached( p ); // fills the tile containing p.
+   * @endcode
+   *
+   * @note The underlying image is stored as an alias: it must exist
+   * as long as the TileCachedImage is used. If its values change,
+   * call clear().
+   */
+  template <typename TImage>
+  class TileCachedImage
+  {
+    // ----------------------- Types ------------------------------
+  public:
+    typedef TileCachedImage<TImage> Self;
+    BOOST_CONCEPT_ASSERT(( concepts::CConstImage<TImage> ));
+
+    typedef TImage Image;
+    typedef typename TImage::Domain Domain;
+    typedef typename TImage::Point Point;
+    typedef typename TImage::Value Value;
+    typedef typename Domain::Integer Integer;
+    typedef DefaultConstImageRange<Self> ConstRange;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     *
+     * @param anImage the image to cache (alias).
+     * @param aTileSize the side of the tiles (number of points per
+     * dimension, at least 1).
+     */
+    TileCachedImage( ConstAlias<Image> anImage, Integer aTileSize = 32 );
+
+    /**
+     * Copy constructor. The copy views the same image with the same
+     * tiles, but starts with an empty cache.
+     * @param other the object to clone.
+     */
+    TileCachedImage( const TileCachedImage & other );
+
+    /**
+     * Assignment. The cache is emptied.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    TileCachedImage & operator=( const TileCachedImage & other );
+
+    /**
+     * Destructor.
+     */
+    ~TileCachedImage();
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * @return the domain of the underlying image.
+     */
+    const Domain & domain() const
+    {
+      return myImagePtr->domain();
+    }
+
+    /**
+     * @return a range on the values of the image.
+     */
+    ConstRange constRange() const
+    {
+      return ConstRange( *this );
+    }
+
+    /**
+     * Get the value of the image at a given point. The tile
+     * containing the point is evaluated if it was not already.
+     *
+     * @pre the point must be in the domain
+     *
+     * @param aPoint the point.
+     * @return the value at aPoint.
+     */
+    Value operator()( const Point & aPoint ) const;
+
+    /**
+     * Evaluates in parallel all the tiles that are not yet in the
+     * cache.
+     */
+    void fill() const;
+
+    /**
+     * Empties the cache (e.g. when the values of the underlying image
+     * have changed).
+     */
+    void clear();
+
+    /**
+     * @return the side of the tiles.
+     */
+    Integer tileSize() const
+    {
+      return myTileSize;
+    }
+
+    /**
+     * @return the total number of tiles.
+     */
+    std::size_t nbTiles() const
+    {
+      return myNbTiles;
+    }
+
+    /**
+     * @return the number of tiles already evaluated.
+     */
+    std::size_t nbFilledTiles() const
+    {
+      return myNbFilledTiles.load();
+    }
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const
+    {
+      return myImagePtr->isValid() && ( myTileSize > 0 );
+    }
+
+    /**
+     * @return the style name used for drawing this object.
+     */
+    std::string className() const
+    {
+      return "TileCachedImage";
+    }
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// Computes the tile grid and allocates an empty cache.
+    void init();
+
+    /// Releases the memory of all the tiles.
+    void release();
+
+    /**
+     * @param aTile the index of a tile.
+     * @return the domain of the tile (clipped to the image domain).
+     */
+    Domain tileDomain( std::size_t aTile ) const;
+
+    /**
+     * @param aTile the index of a tile.
+     * @return the values of the tile, evaluated if necessary.
+     */
+    const Value * tile( std::size_t aTile ) const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// Alias on the underlying image.
+    const Image * myImagePtr;
+
+    /// Side of the tiles.
+    Integer myTileSize;
+
+    /// Number of tiles along each axis.
+    Point myGridSize;
+
+    /// Total number of tiles.
+    std::size_t myNbTiles;
+
+    /// Values of each tile (in the linear order of the tile domain), or 0.
+    std::unique_ptr< std::atomic<Value*>[] > myTiles;
+
+    /// Number of evaluated tiles.
+    mutable std::atomic<std::size_t> myNbFilledTiles;
+
+  }; // end of class TileCachedImage
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'TileCachedImage'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'TileCachedImage' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TImage>
+  std::ostream&
+  operator<< ( std::ostream & out, const TileCachedImage<TImage> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/TileCachedImage.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined TileCachedImage_h
+
+#undef TileCachedImage_RECURSES
+#endif // else defined(TileCachedImage_RECURSES)
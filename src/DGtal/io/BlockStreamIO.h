@@ -0,0 +1,250 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file BlockStreamIO.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module BlockStreamIO.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(BlockStreamIO_RECURSES)
+#error Recursive header files inclusion detected in BlockStreamIO.h
+#else // defined(BlockStreamIO_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define BlockStreamIO_RECURSES
+
+#if !defined BlockStreamIO_h
+/** Prevents repeated inclusion of headers. */
+#define BlockStreamIO_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <cstdio>
+#include <cstddef>
+#include <vector>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  template <typename TDomain, typename TValue>
+  class ImageContainerBySTLVector;
+
+  /////////////////////////////////////////////////////////////////////////////
+  // struct BlockStreamIO
+  /**
+   * Description of struct 'BlockStreamIO' <p>
+   * \brief Aim: block-streaming transfer of raw voxel payloads
+   * between files and image value ranges.
+   *
+   * Volumetric file formats (vol, longvol, pgm3d) store their voxel
+   * values as a contiguous (possibly zlib-compressed) payload in the
+   * domain scanning order. Instead of reading or writing such payloads
+   * one voxel at a time through formatted streams, the methods of this
+   * class move them by large chunks (4 MiB by default): chunks are
+   * read with a single call, inflated/deflated in place with zlib and
+   * decoded (little-endian words) directly into an output iterator on
+   * image values.
+   *
+   * The memory overhead is bounded by the chunk size, whatever the size
+   * of the volume. When the target image is an
+   * ImageContainerBySTLVector, the output iterator of its range is a
+   * plain iterator on its storage so that decoded values are written
+   * directly in place. Other images providing a range output iterator
+   * (e.g. ImageContainerBySTLMap) are fed one value at a time, in the
+   * domain order.
+   *
+   * @note Payloads are always read through buffered chunks: there is
+   * no memory-mapped path (use ImageContainerByMappedRawFile to map an
+   * uncompressed raw file instead), and images without a range output
+   * iterator, like TiledImage, cannot be fed slab by slab.
+   *
+   * Example usage:
+   * @code
+   * FILE * fin = fopen( "data.raw", "rb" );
+   * Image image( domain );
+   * Image::Range r = image.range();
+   * BlockStreamIO::readWords<unsigned char>( fin, domain.size(), false,
+   *                                          r.outputIterator(),
+   *                                          functors::Cast<Image::Value>() );
+   * @endcode
+   *
+   * @see VolReader, LongvolReader, PGMReader, VolWriter, LongvolWriter
+   * @see testBlockStreamIO.cpp
+   */
+  struct BlockStreamIO
+  {
+    /// Default size (in bytes) of the chunks read or written at once.
+    static const std::size_t DEFAULT_CHUNK_SIZE = 4194304;
+
+    /**
+     * Reads @a nbWords words of type @a Word (stored in little-endian
+     * order) from @a in, possibly zlib-inflated, and writes
+     * aFunctor( word ) for each of them through @a out.
+     *
+     * @param in the input (either a FILE* or a std::istream)
+     * positioned at the beginning of the payload.
+     * @param nbWords the number of words to decode.
+     * @param compressed if 'true', the payload is a zlib stream.
+     * @param out the output iterator on values.
+     * @param aFunctor the functor applied to each decoded word.
+     * @param chunkSize the number of bytes processed at once.
+     * @return the output iterator after the last written value.
+     *
+     * @tparam Word an unsigned integer type.
+     * @tparam TInput either FILE* or a model of std::istream.
+     * @tparam TOutputIterator a model of output iterator.
+     * @tparam TFunctor a model of CUnaryFunctor on Word.
+     *
+     * @throw IOException if the payload is truncated or corrupted.
+     */
+    template <typename Word, typename TInput,
+              typename TOutputIterator, typename TFunctor>
+    static
+    TOutputIterator readWords( TInput & in, std::size_t nbWords,
+                               bool compressed,
+                               TOutputIterator out,
+                               const TFunctor & aFunctor,
+                               std::size_t chunkSize = DEFAULT_CHUNK_SIZE );
+
+    /**
+     * Writes aFunctor( v ) as a little-endian word of type @a Word for
+     * the @a nbWords values v of the range starting at @a it, possibly
+     * zlib-deflated, into @a out.
+     *
+     * @param out the output stream.
+     * @param it an iterator on the first value.
+     * @param nbWords the number of values to write.
+     * @param compressed if 'true', the payload is written as a zlib stream.
+     * @param aFunctor the functor converting values into words.
+     * @param chunkSize the number of bytes processed at once.
+     *
+     * @tparam Word an unsigned integer type.
+     * @tparam TInputIterator a model of input iterator on values.
+     * @tparam TFunctor a model of CUnaryFunctor returning Word.
+     *
+     * @throw IOException if the stream cannot be written.
+     */
+    template <typename Word, typename TInputIterator, typename TFunctor>
+    static
+    void writeWords( std::ostream & out, TInputIterator it,
+                     std::size_t nbWords, bool compressed,
+                     const TFunctor & aFunctor,
+                     std::size_t chunkSize = DEFAULT_CHUNK_SIZE );
+
+    /**
+     * Writes the values of @a aImage in the scanning order of its
+     * domain, as little-endian words of type @a Word (see writeWords).
+     * Values are read through the image (i.e. aImage( p ) for each
+     * point p of the domain), whatever the order of its range.
+     *
+     * @param out the output stream.
+     * @param aImage any image.
+     * @param compressed if 'true', the payload is written as a zlib stream.
+     * @param aFunctor the functor converting values into words.
+     *
+     * @throw IOException if the stream cannot be written.
+     */
+    template <typename Word, typename TImage, typename TFunctor>
+    static
+    void writeImage( std::ostream & out, const TImage & aImage,
+                     bool compressed, const TFunctor & aFunctor );
+
+    /**
+     * Writes the values of @a aImage as little-endian words of type
+     * @a Word (see writeWords). The values of an
+     * ImageContainerBySTLVector are stored in the scanning order of
+     * its domain, so they are read directly from its storage.
+     *
+     * @param out the output stream.
+     * @param aImage an image stored in a vector.
+     * @param compressed if 'true', the payload is written as a zlib stream.
+     * @param aFunctor the functor converting values into words.
+     *
+     * @throw IOException if the stream cannot be written.
+     */
+    template <typename Word, typename TDomain, typename TValue, typename TFunctor>
+    static
+    void writeImage( std::ostream & out,
+                     const ImageContainerBySTLVector<TDomain, TValue> & aImage,
+                     bool compressed, const TFunctor & aFunctor );
+
+    /**
+     * Reads at most @a n bytes from @a in.
+     * @param in any C file.
+     * @param buffer the destination buffer.
+     * @param n the number of bytes to read.
+     * @return the number of bytes actually read.
+     */
+    static std::size_t readBytes( FILE * in, unsigned char * buffer,
+                                  std::size_t n );
+
+    /**
+     * Reads at most @a n bytes from @a in.
+     * @param in any input stream.
+     * @param buffer the destination buffer.
+     * @param n the number of bytes to read.
+     * @return the number of bytes actually read.
+     */
+    static std::size_t readBytes( std::istream & in, unsigned char * buffer,
+                                  std::size_t n );
+
+  private:
+
+    /**
+     * Decodes @a n little-endian words from @a buffer into @a out,
+     * which is advanced past the last written value.
+     */
+    template <typename Word, typename TOutputIterator, typename TFunctor>
+    static
+    void decodeWords( const unsigned char * buffer, std::size_t n,
+                      TOutputIterator & out,
+                      const TFunctor & aFunctor );
+
+    /**
+     * Encodes @a n values from @a it as little-endian words into
+     * @a buffer. The iterator @a it is advanced past the last read value.
+     */
+    template <typename Word, typename TInputIterator, typename TFunctor>
+    static
+    void encodeWords( TInputIterator & it, std::size_t n,
+                      unsigned char * buffer,
+                      const TFunctor & aFunctor );
+
+  }; // end of struct BlockStreamIO
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/BlockStreamIO.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined BlockStreamIO_h
+
+#undef BlockStreamIO_RECURSES
+#endif // else defined(BlockStreamIO_RECURSES)
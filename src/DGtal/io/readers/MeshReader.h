@@ -41,8 +41,11 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <string>
+#include <vector>
 #include <DGtal/kernel/SpaceND.h>
 #include "DGtal/base/Common.h"
+#include "DGtal/io/Color.h"
 #include "DGtal/shapes/Mesh.h"
 
 //////////////////////////////////////////////////////////////////////////////
@@ -57,7 +60,7 @@ namespace DGtal
 /**
  * Description of class 'MeshReader' <p> 
  * \brief Aim: Defined to import
- * OFF and OFS surface mesh. It allows to import a Mesh object and takes
+ * OFF, OFS, PLY (ascii or binary) and binary STL surface mesh. It allows to import a Mesh object and takes
  * into accouts the optional color faces.
  * 
  * The importation can be done automatically according the input file
@@ -127,6 +130,54 @@ public:
   static  bool  importOFSFile(const std::string & filename, 
 			      DGtal::Mesh<TPoint> & aMesh, bool invertVertexOrder=false, double scale=1.0);
   
+
+ /** 
+  * Main method to import PLY meshes file (ascii, binary little
+  * endian or binary big endian). The vertex positions (x, y, z),
+  * the faces (vertex_indices) and their colors (red, green, blue and
+  * optionally alpha) are imported, other elements and properties are
+  * skipped. The binary data are read by one large block.
+  * 
+  * @param filename the file name to import.
+  * @param aMesh (return) the mesh object to be imported.
+  * @param invertVertexOrder used to invert (default value=false) the order of imported points (important for normal orientation). 
+  * @return true if the mesh has been imported correctly.
+  */
+  static  bool  importPLYFile(const std::string & filename, 
+			      DGtal::Mesh<TPoint> & aMesh, bool invertVertexOrder=false);
+
+
+ /** 
+  * Main method to import PLY meshes file, with the normals (nx, ny,
+  * nz) and colors (red, green, blue, alpha) of the vertices.
+  * 
+  * @param filename the file name to import.
+  * @param aMesh (return) the mesh object to be imported.
+  * @param vertexNormals (return) the normals of the imported vertices (empty if not in the file).
+  * @param vertexColors (return) the colors of the imported vertices (empty if not in the file).
+  * @param invertVertexOrder used to invert (default value=false) the order of imported points (important for normal orientation). 
+  * @return true if the mesh has been imported correctly.
+  */
+  static  bool  importPLYFile(const std::string & filename, 
+			      DGtal::Mesh<TPoint> & aMesh,
+			      std::vector<TPoint> & vertexNormals,
+			      std::vector<DGtal::Color> & vertexColors,
+			      bool invertVertexOrder=false);
+
+
+ /** 
+  * Main method to import binary STL meshes file. The vertices
+  * shared by several triangles (with the same coordinates) are
+  * merged, and numbered by first occurrence.
+  * 
+  * @param filename the file name to import.
+  * @param aMesh (return) the mesh object to be imported.
+  * @param invertVertexOrder used to invert (default value=false) the order of imported points (important for normal orientation). 
+  * @return true if the mesh has been imported correctly.
+  */
+  static  bool  importSTLFile(const std::string & filename, 
+			      DGtal::Mesh<TPoint> & aMesh, bool invertVertexOrder=false);
+  
   
   
 
@@ -85,7 +85,11 @@ namespace DGtal
    *
    * @tparam TFunctor the type of functor used in the import (by default set to functors::Cast< TImageContainer::Value>) .
    *
+   * For large volumes, ImageContainerByMappedRawFile maps a raw file
+   * into memory instead of copying it.
+   *
    * @see RawWriter
+   * @see ImageContainerByMappedRawFile
    * @see testRawReader.cpp
    */
   template <typename TImageContainer,
@@ -92,26 +92,6 @@ namespace DGtal
                               const bool compressed = true,
                               const Functor & aFunctor = Functor());
     
-    
-  private: 
-    
-    /** 
-     * Generic write word (binary mode) in little-endian.
-     * 
-     * @param outs output stream.
-     * @param value value to write.
-     * 
-     * @return modified stream.
-     */
-    template <typename Word>
-    static
-    std::ostream& write_word( std::ostream& outs, Word value )
-    {
-      for (unsigned size = sizeof( Word ); size; --size, value >>= 8)
-        outs.put( static_cast <char> (value & 0xFF) );
-      return outs;
-    }
-    
   };
 }//namespace
 
@@ -42,22 +42,107 @@
 // Inclusions
 #include <iostream>
 #include <string>
+#include <vector>
+#include <cstring>
+#include <algorithm>
 #include <boost/static_assert.hpp>
 #include "DGtal/base/Common.h"
+#include "DGtal/io/Color.h"
 #include "DGtal/shapes/Mesh.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
 {
 
+  namespace detail
+  {
+    /**
+     * Description of class 'BinaryOutputBuffer' <p>
+     * \brief Aim: Accumulates binary values in memory and writes them
+     * by large blocks into an output stream, optionally swapping their
+     * bytes (to write a given endianness). Used by the binary mesh
+     * writers.
+     */
+    class BinaryOutputBuffer
+    {
+    public:
+      /**
+       * Constructor.
+       * @param out the output stream.
+       * @param swapBytes when 'true', the bytes of each value are reversed.
+       * @param capacity the size of the blocks written into the stream.
+       */
+      BinaryOutputBuffer( std::ostream & out, bool swapBytes = false,
+                          std::size_t capacity = 1 << 20 )
+        : myOut( out ), mySwap( swapBytes ), myCapacity( capacity )
+      {
+        myBuffer.reserve( capacity );
+      }
+
+      /// Destructor. Writes the remaining values.
+      ~BinaryOutputBuffer() { flush(); }
+
+      /// @return 'true' if the machine is little endian.
+      static bool isLittleEndian()
+      {
+        const uint16_t one = 1;
+        unsigned char c;
+        std::memcpy( &c, &one, 1 );
+        return c == 1;
+      }
+
+      /// Appends a value to the buffer.
+      /// @param value any arithmetic value.
+      template <typename T>
+      void put( T value )
+      {
+        char bytes[ sizeof( T ) ];
+        std::memcpy( bytes, &value, sizeof( T ) );
+        if ( mySwap ) std::reverse( bytes, bytes + sizeof( T ) );
+        myBuffer.insert( myBuffer.end(), bytes, bytes + sizeof( T ) );
+        if ( myBuffer.size() >= myCapacity ) flush();
+      }
+
+      /// Appends raw bytes to the buffer.
+      /// @param bytes the bytes.
+      /// @param n the number of bytes.
+      void write( const char* bytes, std::size_t n )
+      {
+        myBuffer.insert( myBuffer.end(), bytes, bytes + n );
+        if ( myBuffer.size() >= myCapacity ) flush();
+      }
+
+      /// Writes the buffer into the output stream.
+      void flush()
+      {
+        if ( ! myBuffer.empty() )
+          myOut.write( myBuffer.data(), myBuffer.size() );
+        myBuffer.clear();
+      }
+
+    private:
+      std::ostream & myOut;
+      bool mySwap;
+      std::size_t myCapacity;
+      std::vector<char> myBuffer;
+    };
+  } // namespace detail
+
   /////////////////////////////////////////////////////////////////////////////
   // template class MeshWriter
   /**
    * Description of template struct 'MeshWriter' <p>
-   * \brief Aim: Export a Mesh (Mesh object) in different format as OFF and OBJ).
+   * \brief Aim: Export a Mesh (Mesh object) in different format as OFF and OBJ,
+   * binary PLY and binary STL).
    * 
    * The exportation can be done automatically according the input file
    * extension with the ">>" operator  
+   *
+   * The binary formats are written through large buffered blocks,
+   * which is much faster than the formatting of text formats for big
+   * meshes. The generic export2PLY and export2STL methods take the
+   * vertices and the faces (as a MeshFaceStorage) of any kind of
+   * mesh, with optional normals and colors per vertex or per face.
    * 
    * Example of typical use: 
    * First you have to add the following include files:
@@ -119,7 +204,85 @@ namespace DGtal
     static bool export2OBJ_colors(std::ostream &out, std::ostream &outMTL,
                                   const std::string nameMTLFile,
                                   const  Mesh<TPoint>  &aMesh);
-    
+
+
+    /** 
+     * Export a Mesh towards a binary PLY format (with the endianness
+     * of the machine). Vertex coordinates are written as floats and
+     * faces as lists of int vertex indices. By default the face colors
+     * are exported (if they are stored in the Mesh object).
+     * 
+     * @param out the output stream of the exported PLY object (should be opened in binary mode).
+     * @param aMesh the Mesh object to be exported.
+     * @param exportColor true to try to export the face colors if they are stored in the Mesh object (default true). 
+     * @return true if no errors occur.
+     */
+    static bool export2PLY(std::ostream &out, const  Mesh<TPoint>  &aMesh, 
+                           bool exportColor=true);
+
+
+    /** 
+     * Export a Mesh towards a binary STL format. Non triangular faces
+     * are triangulated as fans, and triangle normals are computed from
+     * the vertex positions.
+     * 
+     * @param out the output stream of the exported STL object (should be opened in binary mode).
+     * @param aMesh the Mesh object to be exported.
+     * @return true if no errors occur.
+     */
+    static bool export2STL(std::ostream &out, const  Mesh<TPoint>  &aMesh);
+
+
+    /** 
+     * Export any mesh, given by its vertices and faces, towards a
+     * binary PLY format (with the endianness of the machine). Each
+     * optional attribute is exported only when its vector has the
+     * size of the vertices (resp. faces): normals as float properties
+     * nx, ny, nz and colors as uchar properties red, green, blue,
+     * alpha.
+     * 
+     * @param out the output stream of the exported PLY object (should be opened in binary mode).
+     * @param itb an iterator on the first vertex position.
+     * @param ite an iterator after the last vertex position.
+     * @param faces the faces of the mesh.
+     * @param vertexNormals either empty or the normal vector of each vertex.
+     * @param vertexColors either empty or the color of each vertex.
+     * @param faceNormals either empty or the normal vector of each face.
+     * @param faceColors either empty or the color of each face.
+     * @return true if no errors occur, false (and nothing is written)
+     * if a face has a vertex index outside [0, ite - itb).
+     * @tparam TVertexIterator a model of random access iterator on points.
+     */
+    template <typename TVertexIterator>
+    static bool export2PLY(std::ostream &out,
+                           TVertexIterator itb, TVertexIterator ite,
+                           const MeshFaceStorage &faces,
+                           const std::vector<TPoint> &vertexNormals,
+                           const std::vector<DGtal::Color> &vertexColors,
+                           const std::vector<TPoint> &faceNormals,
+                           const std::vector<DGtal::Color> &faceColors);
+
+
+    /** 
+     * Export any mesh, given by its vertices and faces, towards a
+     * binary STL format. Non triangular faces are triangulated as fans.
+     * 
+     * @param out the output stream of the exported STL object (should be opened in binary mode).
+     * @param itb an iterator on the first vertex position.
+     * @param ite an iterator after the last vertex position.
+     * @param faces the faces of the mesh.
+     * @param faceNormals either empty or the normal vector of each
+     * face, otherwise the normal of each triangle is computed from its
+     * vertices.
+     * @return true if no errors occur, false (and nothing is written)
+     * if a face has a vertex index outside [0, ite - itb).
+     * @tparam TVertexIterator a model of random access iterator on points.
+     */
+    template <typename TVertexIterator>
+    static bool export2STL(std::ostream &out,
+                           TVertexIterator itb, TVertexIterator ite,
+                           const MeshFaceStorage &faces,
+                           const std::vector<TPoint> &faceNormals);
     
   };
   
@@ -130,7 +293,7 @@ namespace DGtal
   /**
    *  'operator>>' for exporting objects of class 'Mesh'.
    *  This operator automatically selects the good method according to
-   *  the filename extension (off, obj).
+   *  the filename extension (off, obj, ply, stl).
    *  
    * @param aMesh the mesh to be exported.
    * @param aFilename the filename of the file to be exported. 
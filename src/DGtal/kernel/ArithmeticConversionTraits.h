@@ -40,6 +40,7 @@
 // Inclusions
 #include <type_traits>
 #include "DGtal/base/Common.h"
+#include "DGtal/kernel/NumberTraits.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -124,6 +125,24 @@ namespace DGtal
     using type = typename std::common_type<T, U>::type; //! Arithmetic operation result type.
   };
 
+#ifdef DGTAL_HAS_INT128
+  /** @brief Specialization for 128-bit integers mixed with arithmetic
+   * types, when the standard library does not consider them as
+   * arithmetic types (strict ISO modes).
+   *
+   * @see ArithmeticConversionTraits
+   */
+  template <typename T, typename U>
+  struct ArithmeticConversionTraits< T, U,
+      typename std::enable_if<    ( details::IsInt128<T>::value || details::IsInt128<U>::value )
+                               && ( details::IsInt128<T>::value || std::is_arithmetic<T>::value )
+                               && ( details::IsInt128<U>::value || std::is_arithmetic<U>::value )
+                               && ! ( std::is_arithmetic<T>::value && std::is_arithmetic<U>::value ) >::type >
+  {
+    using type = typename std::common_type<T, U>::type; //! Arithmetic operation result type.
+  };
+#endif
+
   /** @brief Result type of arithmetic binary operators between two given types.
    *
    * @tparam T      First operand type.
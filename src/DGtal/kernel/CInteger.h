@@ -78,7 +78,7 @@ Description of \b concept '\b CInteger' <p>
 
     
  # Models
-BigInteger,  short, int, long long, int16_t, int32_t, int64_t, ...
+BigInteger,  short, int, long long, int16_t, int32_t, int64_t, int128_t, ...
 
  # Notes
 
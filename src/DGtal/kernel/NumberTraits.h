@@ -376,6 +376,158 @@ namespace DGtal
     using UnsignedVersion = T; ///< Alias to the unsigned version of a floating-point type (aka itself).
   }; // end of class NumberTraitsImpl
 
+#ifdef DGTAL_HAS_INT128
+  namespace details
+  {
+    /// Tells if T is one of the 128-bit integer types.
+    template <typename T>
+    struct IsInt128
+      : std::integral_constant< bool,
+                                std::is_same<T, DGtal::int128_t>::value
+                                || std::is_same<T, DGtal::uint128_t>::value >
+    {};
+  } // namespace details
+
+  /** @brief Specialization of NumberTraitsImpl for DGtal::int128_t and
+   * DGtal::uint128_t when the standard library does not consider them
+   * as integral types (strict ISO modes, e.g. -std=c++11 instead of
+   * -std=gnu++11).
+   *
+   * Otherwise they are handled as any other fundamental integer type.
+   */
+  template <typename T>
+  struct NumberTraitsImpl<T, typename std::enable_if< details::IsInt128<T>::value
+                                                      && ! std::is_integral<T>::value >::type>
+  {
+    typedef TagTrue IsIntegral;     ///< A 128-bit integer is of integral type.
+    typedef TagTrue IsBounded;      ///< A 128-bit integer is bounded.
+    typedef typename details::BoolToTag< std::is_same<T, DGtal::uint128_t>::value >::type
+      IsUnsigned;                   ///< Is the number unsigned.
+    typedef typename details::BoolToTag< std::is_same<T, DGtal::int128_t>::value >::type
+      IsSigned;                     ///< Is the number signed.
+    typedef TagTrue IsSpecialized;  ///< Is that a number type with specific traits.
+
+    typedef DGtal::int128_t  SignedVersion;   ///< Alias to the signed version of the number type.
+    typedef DGtal::uint128_t UnsignedVersion; ///< Alias to the unsigned version of the number type.
+    typedef T ReturnType;           ///< Alias to the type that should be used as return type.
+    typedef T ParamType;            ///< A 128-bit integer is passed by value.
+
+    /// Constant Zero.
+    static constexpr T ZERO = T(0);
+
+    /// Constant One.
+    static constexpr T ONE  = T(1);
+
+    /// Return the zero of this integer.
+    static inline constexpr
+    ReturnType zero() noexcept
+    {
+      return ZERO;
+    }
+
+    /// Return the one of this integer.
+    static inline constexpr
+    ReturnType one() noexcept
+    {
+      return ONE;
+    }
+
+    /// Return the minimum possible value for this type of number.
+    static inline constexpr
+    ReturnType min() noexcept
+    {
+      return std::is_same<T, DGtal::uint128_t>::value
+        ? T(0) : T( - static_cast<DGtal::int128_t>( max() ) - 1 );
+    }
+
+    /// Return the maximum possible value for this type of number.
+    static inline constexpr
+    ReturnType max() noexcept
+    {
+      return std::is_same<T, DGtal::uint128_t>::value
+        ? T( ~ DGtal::uint128_t(0) )
+        : T( ~ DGtal::uint128_t(0) >> 1 );
+    }
+
+    /// Return the number of significant binary digits for this type of number.
+    static inline constexpr
+    unsigned int digits() noexcept
+    {
+      return std::is_same<T, DGtal::uint128_t>::value ? 128 : 127;
+    }
+
+    /** @brief Return the bounding type of the number.
+     *
+     * @return BOUNDED, UNBOUNDED, or BOUND_UNKNOWN.
+     */
+    static inline constexpr
+    BoundEnum isBounded() noexcept
+    {
+      return BOUNDED;
+    }
+
+    /** @brief Return the sign type of the number.
+     *
+     * @return SIGNED, UNSIGNED or SIGN_UNKNOWN.
+     */
+    static inline constexpr
+    SignEnum isSigned() noexcept
+    {
+      return std::is_same<T, DGtal::uint128_t>::value ? UNSIGNED : SIGNED;
+    }
+
+    /** @brief
+     * Cast method to DGtal::int64_t (for I/O or board export uses
+     * only).
+     */
+    static inline constexpr
+    DGtal::int64_t castToInt64_t(const T & aT) noexcept
+    {
+      return static_cast<DGtal::int64_t>(aT);
+    }
+
+    /** @brief
+     * Cast method to double (for I/O or board export uses
+     * only).
+     */
+    static inline constexpr
+    double castToDouble(const T & aT) noexcept
+    {
+      return static_cast<double>(aT);
+    }
+
+    /** @brief Check the parity of a number.
+     *
+     * @param aT any number.
+     * @return 'true' iff the number is even.
+     */
+    static inline constexpr
+    bool even( ParamType aT ) noexcept
+    {
+      return ( aT & ONE ) == ZERO;
+    }
+
+    /** @brief Check the parity of a number.
+     *
+     * @param aT any number.
+     * @return 'true' iff the number is odd.
+     */
+    static inline constexpr
+    bool odd( ParamType aT ) noexcept
+    {
+      return ( aT & ONE ) != ZERO;
+    }
+  }; // end of class NumberTraitsImpl
+
+  // Definition of the static attributes in order to allow ODR-usage.
+  template <typename T>
+  constexpr T NumberTraitsImpl<T, typename std::enable_if< details::IsInt128<T>::value
+                                                           && ! std::is_integral<T>::value >::type>::ZERO;
+  template <typename T>
+  constexpr T NumberTraitsImpl<T, typename std::enable_if< details::IsInt128<T>::value
+                                                           && ! std::is_integral<T>::value >::type>::ONE;
+#endif
+
 #ifdef WITH_BIGINTEGER
   /** @brief Specialization of NumberTraitsImpl for DGtal::BigInteger
    *
@@ -326,6 +326,21 @@ namespace DGtal
     */
     Signal<TValue> operator*( const Signal<TValue>& G );
 
+    /** 
+        Convolution product of this signal with the gaussian signal
+        G2n( n ). The result is the same as ( *this ) * G2n( n ), but
+        it is computed by n successive in-place passes of the G2 mask,
+        without building G2n( n ). For a signal of size N, this takes
+        O(nN) operations, as the direct convolution by G2n( n ), with a
+        smaller constant and no temporary signal.
+
+        @param n the order of the gaussian signal (n = 1 if n is 0).
+        @return the signal that is the convolution of this signal and
+        G2n( n ). The returned signal is periodic iff this signal is
+        periodic.
+    */
+    Signal<TValue> convolveG2n( unsigned int n ) const;
+
     // ----------------------- Interface --------------------------------------
   public:
 
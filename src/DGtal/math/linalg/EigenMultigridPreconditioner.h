@@ -0,0 +1,309 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file EigenMultigridPreconditioner.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module EigenMultigridPreconditioner.ih
+ *
+ * This file is included by EigenSupport.h and should not be included
+ * directly.
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(EigenMultigridPreconditioner_RECURSES)
+#error Recursive header files inclusion detected in EigenMultigridPreconditioner.h
+#else // defined(EigenMultigridPreconditioner_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define EigenMultigridPreconditioner_RECURSES
+
+#if !defined EigenMultigridPreconditioner_h
+/** Prevents repeated inclusion of headers. */
+#define EigenMultigridPreconditioner_h
+
+#if !defined(EigenSupport_RECURSES)
+#error "EigenMultigridPreconditioner.h is included by DGtal/math/linalg/EigenSupport.h"
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class EigenMultigridPreconditioner
+  /**
+   * Description of template class 'EigenMultigridPreconditioner' <p>
+   * \brief Aim:
+   * Smoothed aggregation algebraic multigrid preconditioner, usable
+   * as the preconditioner of Eigen iterative solvers (see
+   * EigenLinearAlgebraBackend::SolverMultigridConjugateGradient and
+   * EigenLinearAlgebraBackend::SolverMultigridBiCGSTAB).
+   *
+   * The hierarchy is built once by compute(): at each level, unknowns
+   * are grouped into aggregates of strongly connected neighbors, the
+   * piecewise constant prolongation is smoothed by one damped Jacobi
+   * step and the coarse operator is the Galerkin product P^T A P. The
+   * coarsest level is solved by a sparse LU factorization. solve()
+   * applies one V-cycle with damped Jacobi smoothing, which is a
+   * symmetric operator when the matrix is symmetric.
+   *
+   * On calculi built on digital sets (e.g. with
+   * DiscreteExteriorCalculusFactory::createFromDigitalSet), the matrix
+   * graph is the grid adjacency, so aggregates are compact groups of
+   * neighboring cells and each level is about 5 to 10 times coarser.
+   * Unlike direct factorizations, memory grows linearly with the number
+   * of unknowns.
+   *
+   * @note The matrix should have a non zero diagonal, like Laplace
+   * operators (positive or negative semi-definite). Matrix-vector
+   * products on each level are row-major, hence parallelized by
+   * Eigen when OpenMP is enabled.
+   *
+   * @tparam TScalar the scalar type (e.g. double).
+   */
+  template <typename TScalar>
+  class EigenMultigridPreconditioner
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+    typedef EigenMultigridPreconditioner<TScalar> Self;
+    typedef TScalar Scalar;
+    typedef Eigen::Matrix<Scalar, Eigen::Dynamic, 1> Vector;
+    typedef Eigen::SparseMatrix<Scalar, Eigen::RowMajor, int> RowMatrix;
+    typedef Eigen::SparseMatrix<Scalar, Eigen::ColMajor, int> ColMatrix;
+    typedef Eigen::Index Index;
+
+    /**
+     * Constructor. The preconditioner is the identity until compute()
+     * is called.
+     */
+    EigenMultigridPreconditioner();
+
+    /**
+     * Constructor. Builds the hierarchy of \a matrix.
+     * @tparam MatType any Eigen sparse matrix type.
+     * @param matrix a square matrix.
+     */
+    template <typename MatType>
+    explicit EigenMultigridPreconditioner(const MatType& matrix);
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Does nothing, the hierarchy depends on the matrix values.
+     * @return *this.
+     */
+    template <typename MatType>
+    Self& analyzePattern(const MatType& matrix);
+
+    /**
+     * Builds the hierarchy of \a matrix, like compute().
+     * @return *this.
+     */
+    template <typename MatType>
+    Self& factorize(const MatType& matrix);
+
+    /**
+     * Builds the multigrid hierarchy of \a matrix.
+     * @tparam MatType any Eigen sparse matrix type.
+     * @param matrix a square matrix with non zero diagonal.
+     * @return *this.
+     */
+    template <typename MatType>
+    Self& compute(const MatType& matrix);
+
+    /**
+     * Applies one V-cycle to \a b, starting from zero.
+     * @param b the right-hand side.
+     * @return an approximation of the solution of A x = b.
+     */
+    template <typename Rhs>
+    Vector solve(const Rhs& b) const;
+
+    /**
+     * @return Eigen::Success, or Eigen::NumericalIssue if the matrix
+     * had a zero diagonal coefficient.
+     */
+    Eigen::ComputationInfo info() const;
+
+    /// @return the number of rows of the matrix.
+    Index rows() const;
+
+    /// @return the number of columns of the matrix.
+    Index cols() const;
+
+    /// @return the number of levels of the hierarchy.
+    Index nbLevels() const;
+
+    /**
+     * @param level a level of the hierarchy, 0 being the finest.
+     * @return the number of unknowns of this level.
+     */
+    Index levelSize(const Index level) const;
+
+    /**
+     * Sets the strength threshold: a_ij is a strong connection if
+     * |a_ij| >= threshold * sqrt(|a_ii a_jj|) on the finest level.
+     * The threshold is halved at each coarser level, since coarse
+     * operators have wider and weaker stencils. Default is 0.08.
+     * @param threshold a value in [0,1].
+     */
+    void setStrengthThreshold(const Scalar threshold);
+
+    /**
+     * Sets the size below which the level is solved directly. Default is 1000.
+     * @param size the maximal number of unknowns of the coarsest level.
+     */
+    void setCoarsestSize(const Index size);
+
+    /**
+     * Sets the maximal number of levels. Default is 25.
+     * @param nb_levels the maximal number of levels.
+     */
+    void setMaxLevels(const Index nb_levels);
+
+    /**
+     * Sets the number of Jacobi smoothing steps before and after
+     * coarse corrections. Default is 2.
+     * @param nb_steps the number of smoothing steps.
+     */
+    void setSmoothingSteps(const Index nb_steps);
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay(std::ostream& out) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /**
+     * One level of the hierarchy.
+     */
+    struct Level
+    {
+      RowMatrix A; ///< operator of this level.
+      RowMatrix P; ///< prolongation towards this level from the coarser one.
+      RowMatrix R; ///< restriction from this level to the coarser one.
+      Vector weighted_inverse_diagonal; ///< Jacobi weight divided by the diagonal.
+    };
+
+    /// The levels, from the finest to the coarsest.
+    std::vector<Level> myLevels;
+
+    /// Direct solver of the coarsest level.
+    Eigen::SparseLU<ColMatrix> myCoarsestSolver;
+
+    /// 'true' if the coarsest level has been factorized.
+    bool myCoarsestFactorized;
+
+    /// Computation status.
+    Eigen::ComputationInfo myInfo;
+
+    /// Strength threshold.
+    Scalar myStrengthThreshold;
+
+    /// Maximal size of the coarsest level.
+    Index myCoarsestSize;
+
+    /// Maximal number of levels.
+    Index myMaxLevels;
+
+    /// Number of smoothing steps.
+    Index mySmoothingSteps;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Builds the hierarchy from the finest operator.
+     * @param A the finest operator.
+     */
+    void buildHierarchy(RowMatrix A);
+
+    /**
+     * Groups unknowns into aggregates of strongly connected neighbors.
+     * @param A any operator.
+     * @param threshold the strength threshold of this level.
+     * @param aggregates (output) the aggregate of each unknown.
+     * @return the number of aggregates.
+     */
+    Index aggregate(const RowMatrix& A, const Scalar threshold,
+                    std::vector<int>& aggregates) const;
+
+    /**
+     * Estimates the spectral radius of D^-1 A by power iterations.
+     * @param A any operator.
+     * @param inverse_diagonal the inverse of the diagonal of A.
+     * @return an estimation of the spectral radius.
+     */
+    Scalar spectralRadius(const RowMatrix& A, const Vector& inverse_diagonal) const;
+
+    /**
+     * Applies one V-cycle from \a level.
+     * @param level the level.
+     * @param b the right-hand side of this level.
+     * @return the approximate solution.
+     */
+    Vector vCycle(const Index level, const Vector& b) const;
+
+  }; // end of class EigenMultigridPreconditioner
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'EigenMultigridPreconditioner'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'EigenMultigridPreconditioner' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TScalar>
+  std::ostream&
+  operator<<(std::ostream& out, const EigenMultigridPreconditioner<TScalar>& object);
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/math/linalg/EigenMultigridPreconditioner.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined EigenMultigridPreconditioner_h
+
+#undef EigenMultigridPreconditioner_RECURSES
+#endif // else defined(EigenMultigridPreconditioner_RECURSES)
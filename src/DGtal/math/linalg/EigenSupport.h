@@ -74,6 +74,7 @@
 #if defined(__GNUG__) && !defined(__clang__)
 #pragma GCC diagnostic pop
 #endif
+#include "DGtal/math/linalg/EigenMultigridPreconditioner.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -85,13 +86,19 @@ namespace DGtal
  * Description of struct 'EigenLinearAlgebraBackend' <p>
  * \brief Aim:
  * Provide linear algebra backend using Eigen dense and sparse matrix as well as dense vector.
- * 6 linear solvers available:
+ * 8 linear solvers available:
  *  - EigenLinearAlgebraBackend::SolverSimplicialLLT
  *  - EigenLinearAlgebraBackend::SolverSimplicialLDLT
  *  - EigenLinearAlgebraBackend::SolverConjugateGradient
  *  - EigenLinearAlgebraBackend::SolverBiCGSTAB
+ *  - EigenLinearAlgebraBackend::SolverMultigridConjugateGradient
+ *  - EigenLinearAlgebraBackend::SolverMultigridBiCGSTAB
  *  - EigenLinearAlgebraBackend::SolverSparseLU
  *  - EigenLinearAlgebraBackend::SolverSparseQR
+ * The multigrid solvers are preconditioned by one V-cycle of
+ * EigenMultigridPreconditioner. They need little memory and scale
+ * linearly on large Laplace problems of regular digital domains, where
+ * direct factorizations fill in.
  * Eigen solvers documentation <a href="http://eigen.tuxfamily.org/dox/group__TopicSparseSystems.html">here</a>
  */
 struct EigenLinearAlgebraBackend
@@ -107,6 +114,8 @@ struct EigenLinearAlgebraBackend
     typedef Eigen::SimplicialLDLT<SparseMatrix> SolverSimplicialLDLT;
     typedef Eigen::ConjugateGradient<SparseMatrix> SolverConjugateGradient;
     typedef Eigen::BiCGSTAB<SparseMatrix> SolverBiCGSTAB;
+    typedef Eigen::ConjugateGradient<SparseMatrix, Eigen::Lower|Eigen::Upper, EigenMultigridPreconditioner<double> > SolverMultigridConjugateGradient;
+    typedef Eigen::BiCGSTAB<SparseMatrix, EigenMultigridPreconditioner<double> > SolverMultigridBiCGSTAB;
     typedef Eigen::SparseLU<SparseMatrix> SolverSparseLU;
     typedef Eigen::SparseQR<SparseMatrix, Eigen::COLAMDOrdering<SparseMatrix::Index> > SolverSparseQR;
 };
@@ -0,0 +1,335 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file MarchingCubes.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module MarchingCubes.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(MarchingCubes_RECURSES)
+#error Recursive header files inclusion detected in MarchingCubes.h
+#else // defined(MarchingCubes_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define MarchingCubes_RECURSES
+
+#if !defined MarchingCubes_h
+/** Prevents repeated inclusion of headers. */
+#define MarchingCubes_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/shapes/Mesh.h"
+#include "DGtal/shapes/PolygonalSurface.h"
+#include "DGtal/shapes/TriangulatedSurface.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class MarchingCubes
+  /**
+   * Description of template class 'MarchingCubes' <p>
+   * \brief Aim: Extracts the marching-cubes surface of a thresholded
+   * 3D image, by streaming the image slab by slab.
+   *
+   * A voxel is inside the shape whenever its value \a v satisfies
+   * `thresholdMin < v <= thresholdMax`. There is one vertex per pair
+   * of 6-adjacent voxels of the domain that are not both inside nor
+   * both outside (i.e. per boundary surfel), placed by linear
+   * interpolation of the iso-value along the segment joining the two
+   * voxel centers, as ImageLinearCellEmbedder does. There is one
+   * polygonal face per cycle of such vertices around the center of a
+   * cube of 8 voxels of the domain. Faces are oriented so that their
+   * normal points inside the shape.
+   *
+   * The resulting surface is the dual polygonal surface of the
+   * digital surface bounding the thresholded image (see
+   * MeshHelpers::digitalSurface2DualPolygonalSurface), but is obtained
+   * without building the set of surfels nor the digital surface
+   * itself. Planes of voxels are visited one after the other, and only
+   * two planes of edge-vertex indices are kept per thread. Slabs are
+   * processed in parallel (with OpenMP) and the output does not
+   * depend on the number of threads: vertices are numbered by planes
+   * of increasing z, then by rows, and faces are ordered by cube.
+   *
+   * The ambiguous configurations of the marching-cubes, i.e. a square
+   * of four voxels with two diagonally opposite voxels inside, are
+   * resolved according to the surfel adjacency, like the umbrellas of
+   * the digital surface: with the interior to exterior adjacency, the
+   * two inside voxels are separated, otherwise they are connected.
+   *
+   * @code
+   * MarchingCubes< Image > mc;
+   * mc.init( image, 0.0, 255.0, 0.5 );
+   * mc.compute();
+   * TriangulatedSurface< MarchingCubes< Image >::RealPoint > trisurf;
+   * mc.getTriangulatedSurface( trisurf );
+   * @endcode
+   *
+   * @tparam TImage any model of 3D image whose values can be cast to
+   * double.
+   */
+  template <typename TImage>
+  class MarchingCubes
+  {
+    // ----------------------- Types ------------------------------------------
+  public:
+    typedef MarchingCubes<TImage>             Self;
+    typedef TImage                            Image;
+    typedef typename Image::Domain            Domain;
+    typedef typename Image::Value             Value;
+    typedef typename Domain::Point            Point;
+    typedef typename Domain::Space            Space;
+    typedef typename Space::Integer           Integer;
+    typedef typename Space::RealPoint         RealPoint;
+    typedef typename Space::RealVector        RealVector;
+    typedef std::size_t                       Index;
+    BOOST_STATIC_ASSERT(( Space::dimension == 3 ));
+
+    /**
+     * The faces of one configuration of a cube of 8 voxels. The 8
+     * voxels are numbered as \f$ dx + 2dy + 4dz \f$, for their shift
+     * \f$ (dx,dy,dz) \in \{0,1\}^3 \f$ from the lowest one. The 12
+     * edges of the cube are numbered as \f$ 4a + u + 2v \f$, where \a
+     * a is the axis of the edge and \a u, \a v are the shifts of the
+     * edge along the two other axes, in increasing order.
+     */
+    struct CubeConfiguration
+    {
+      /// The number of faces (at most 4).
+      unsigned char nbFaces;
+      /// The number of vertices of each face.
+      unsigned char sizes[ 4 ];
+      /// The edges of the cube holding the vertices of the faces, face after face.
+      unsigned char edges[ 12 ];
+    };
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /// Default constructor. The object is not valid.
+    MarchingCubes();
+
+    /**
+     * Initializes the extractor.
+     *
+     * @param anImage the image (aliased).
+     * @param thresholdMin the threshold min (excluded) defining the inside voxels.
+     * @param thresholdMax the threshold max (included) defining the inside voxels.
+     * @param isoValue the value interpolated to place the vertices.
+     * @param int2ext when 'true', the surfel adjacency is interior to
+     * exterior, when 'false', it is exterior to interior (see SurfelAdjacency).
+     * @param gridstep the space between voxel centers along each axis.
+     */
+    void init( ConstAlias<Image> anImage,
+               double thresholdMin, double thresholdMax, double isoValue,
+               bool int2ext = false,
+               const RealVector & gridstep = RealVector::diagonal( 1.0 ) );
+
+    /**
+     * Extracts the vertices and faces of the surface.
+     *
+     * @param nbChunks the number of groups of consecutive slabs that
+     * are processed independently, or 0 to choose it automatically.
+     */
+    void compute( unsigned int nbChunks = 0 );
+
+    // ----------------------- Accessors --------------------------------------
+  public:
+
+    /// @return the number of vertices of the extracted surface.
+    Index nbVertices() const;
+
+    /// @return the number of faces of the extracted surface.
+    Index nbFaces() const;
+
+    /// @return the positions of the vertices of the extracted surface.
+    const std::vector<RealPoint> & vertices() const;
+
+    /**
+     * @return the offsets of the faces in faceVertices(): the vertices
+     * of face \a f are in the range [ faceOffsets()[f], faceOffsets()[f+1] ).
+     */
+    const std::vector<Index> & faceOffsets() const;
+
+    /// @return the vertex indices of all the faces, face after face.
+    const std::vector<Index> & faceVertices() const;
+
+    /**
+     * @param config any configuration of a cube, i.e. a set of inside
+     * voxels among the 8 ones, given as a bitmask.
+     * @return the faces associated to this configuration.
+     */
+    const CubeConfiguration & configuration( unsigned int config ) const;
+
+    /**
+     * @param aValue any image value.
+     * @return 'true' iff a voxel of value @a aValue is inside the shape.
+     */
+    bool isInside( const Value & aValue ) const;
+
+    // ----------------------- Output -----------------------------------------
+  public:
+
+    /**
+     * Outputs the extracted surface as a polygonal surface.
+     * @param[out] polysurf the output polygonal surface (cleared before).
+     * @return 'true' if the polygonal surface was built successfully.
+     */
+    bool getPolygonalSurface( PolygonalSurface<RealPoint> & polysurf ) const;
+
+    /**
+     * Outputs the extracted surface as a triangulated surface. Non
+     * triangular faces are triangulated by adding a vertex at their
+     * barycenter, after all the vertices of the extracted surface.
+     *
+     * @param[out] trisurf the output triangulated surface (cleared before).
+     * @return 'true' if the triangulated surface was built successfully.
+     */
+    bool getTriangulatedSurface( TriangulatedSurface<RealPoint> & trisurf ) const;
+
+    /**
+     * Outputs the extracted surface as a mesh (vertices and faces are
+     * appended).
+     * @param[in,out] aMesh the output mesh.
+     */
+    void getMesh( Mesh<RealPoint> & aMesh ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+    /// The image.
+    const Image* myImage;
+    /// The threshold min (excluded).
+    double myThresholdMin;
+    /// The threshold max (included).
+    double myThresholdMax;
+    /// The iso-value.
+    double myIsoValue;
+    /// The space between voxel centers.
+    RealVector myGridStep;
+    /// The faces of the 256 configurations of a cube.
+    CubeConfiguration myConfigurations[ 256 ];
+    /// The positions of the vertices.
+    std::vector<RealPoint> myVertices;
+    /// The offsets of the faces in myFaceVertices.
+    std::vector<Index> myFaceOffsets;
+    /// The vertex indices of the faces.
+    std::vector<Index> myFaceVertices;
+
+    // ------------------------- Internals ------------------------------------
+  protected:
+
+    /// The output of a group of consecutive slabs.
+    struct Chunk
+    {
+      /// The positions of the vertices of the planes owned by the chunk.
+      std::vector<RealPoint> vertices;
+      /// The offsets of the faces in faceVertices.
+      std::vector<Index> faceOffsets;
+      /// The vertex indices of the faces, local to the chunk or
+      /// flagged as referring to the first plane of the next chunk.
+      std::vector<Index> faceVertices;
+    };
+
+    /**
+     * Computes the faces of every configuration of a cube.
+     * @param int2ext the surfel adjacency.
+     * @param[out] configs the 256 configurations.
+     */
+    static void computeConfigurations( bool int2ext, CubeConfiguration * configs );
+
+    /**
+     * Extracts the vertices of the planes [ @a z0, @a z1 ) and the
+     * faces of the cubes between these planes and the next ones.
+     * @param z0 the first plane.
+     * @param z1 the plane after the last one.
+     * @param[out] chunk the extracted vertices and faces.
+     */
+    void computeChunk( Integer z0, Integer z1, Chunk & chunk ) const;
+
+    /**
+     * Reads the values of a plane of voxels.
+     * @param z the plane.
+     * @param[out] values the values of the voxels, row after row.
+     * @param[out] inside the inside flags of the voxels, row after row.
+     */
+    void readPlane( Integer z, std::vector<double> & values,
+                    std::vector<unsigned char> & inside ) const;
+
+    /**
+     * Embeds the vertex between a voxel and its successor along an axis.
+     * @param p the voxel.
+     * @param k the axis.
+     * @param v the value of voxel @a p.
+     * @param w the value of the successor of @a p along axis @a k.
+     * @return the interpolated position of the vertex.
+     */
+    RealPoint embed( const Point & p, Dimension k, double v, double w ) const;
+
+  }; // end of class MarchingCubes
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'MarchingCubes'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'MarchingCubes' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TImage>
+  std::ostream&
+  operator<< ( std::ostream & out, const MarchingCubes<TImage> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/shapes/MarchingCubes.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined MarchingCubes_h
+
+#undef MarchingCubes_RECURSES
+#endif // else defined(MarchingCubes_RECURSES)
@@ -45,6 +45,7 @@
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/PointVector.h"
 #include "DGtal/io/Color.h"
+#include "DGtal/shapes/MeshFaceStorage.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -61,7 +62,10 @@ namespace DGtal
    * constructor parameter saveFaceColor to 'true').
    *
    * The mesh object stores explicitly each vertex and each face are
-   * represented with the list of point index.
+   * represented with the list of point index. The faces are stored
+   * in a compressed sparse row layout (see MeshFaceStorage), so that
+   * adding a face does not allocate memory, and faces are accessed
+   * through lightweight views on their vertex indices.
    *
    * @note This class is a preliminary version of a mesh strucuture
    * (the method to access neigborhing facets or to a given facet are
@@ -122,9 +126,20 @@ namespace DGtal
     typedef  std::vector<TPoint> VertexStorage;
 
     /**
-     * Define the type to store the faces of the mesh.
+     * Define the type to store the faces of the mesh (all vertex
+     * indices in a single array, delimited by offsets).
      **/
-    typedef  std::vector<MeshFace> FaceStorage;
+    typedef  MeshFaceStorage FaceStorage;
+
+    /**
+     * Define the type of a view on the vertex indices of a face.
+     **/
+    typedef  FaceStorage::ConstView ConstFaceView;
+
+    /**
+     * Define the type of a mutable view on the vertex indices of a face.
+     **/
+    typedef  FaceStorage::View FaceView;
 
     /**
      * Define the type to store the color associated to each face
@@ -263,6 +278,44 @@ namespace DGtal
     void addFace(const MeshFace &aFace, const DGtal::Color &aColor=DGtal::Color::White);
 
 
+    /**
+     * Add faces with the same number of vertices, given by their
+     * consecutive vertex indices (e.g. a triangle soup with @a
+     * faceSize equal to 3). The faces are appended to the flat face
+     * storage, without intermediate face allocation.
+     *
+     * @param itb an iterator on the first vertex index of the first face.
+     * @param ite an iterator after the last vertex index of the last face.
+     * @param faceSize the number of vertices of each face.
+     * @param aColor the color of the added faces.
+     * @return the number of added faces.
+     * @tparam TInputIterator a model of input iterator on vertex indices.
+     **/
+    template <typename TInputIterator>
+    Size addFaces(TInputIterator itb, TInputIterator ite, unsigned int faceSize,
+                  const DGtal::Color &aColor=DGtal::Color::White);
+
+
+    /**
+     * Add all the faces of a face storage.
+     *
+     * @param someFaces the faces to add (their vertex indices must
+     * refer to vertices of this mesh).
+     * @param aColor the color of the added faces.
+     **/
+    void addFaces(const FaceStorage &someFaces,
+                  const DGtal::Color &aColor=DGtal::Color::White);
+
+
+    /**
+     * Reserve memory for future faces.
+     *
+     * @param nbFaces the expected number of faces.
+     * @param nbIndices the expected total number of vertex indices of the faces.
+     **/
+    void reserveFaces(Size nbFaces, Size nbIndices);
+
+
     /**
      * Remove faces from the mesh. @note the vertexes which are no
      * more associated to any face are also removed.
@@ -288,9 +341,10 @@ namespace DGtal
 
     /**
      * @param i the index of the face.
-     * @return a const reference to the face of index i.
+     * @return a view on the vertex indices of the face of index i
+     * (which can be converted to a MeshFace).
      **/
-    const MeshFace & getFace(unsigned int i) const;
+    ConstFaceView getFace(unsigned int i) const;
 
 
     /**
@@ -303,9 +357,16 @@ namespace DGtal
 
     /**
      * @param i the index of the face.
-     * @return a const reference to the face of index i.
+     * @return a mutable view on the vertex indices of the face of
+     * index i (the number of vertices cannot be changed).
+     **/
+    FaceView getFace(unsigned int i);
+
+
+    /**
+     * @return the storage of all the faces of the mesh.
      **/
-    MeshFace & getFace(unsigned int i);
+    const FaceStorage & faces() const;
 
 
 
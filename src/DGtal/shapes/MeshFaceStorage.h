@@ -0,0 +1,391 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file MeshFaceStorage.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module MeshFaceStorage.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(MeshFaceStorage_RECURSES)
+#error Recursive header files inclusion detected in MeshFaceStorage.h
+#else // defined(MeshFaceStorage_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define MeshFaceStorage_RECURSES
+
+#if !defined MeshFaceStorage_h
+/** Prevents repeated inclusion of headers. */
+#define MeshFaceStorage_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class MeshFaceStorage
+  /**
+   * Description of class 'MeshFaceStorage' <p>
+   * \brief Aim: Stores the faces of a Mesh in compressed sparse row
+   * (CSR) layout, i.e. the vertex indices of all the faces in a single
+   * array, the faces being delimited by an array of offsets.
+   *
+   * Adding a face thus costs no memory allocation (besides the
+   * amortized growth of the two arrays). While all the faces are
+   * triangles, the offsets are not stored at all (face \a i starts at
+   * index \a 3i).
+   *
+   * Faces are accessed through lightweight views (FaceView) on the
+   * vertex indices, which behave like a fixed-size vector and can be
+   * converted to a std::vector<unsigned int>. The iterators on faces
+   * are random-access iterators whose value type is such a view.
+   *
+   * @see Mesh
+   */
+  class MeshFaceStorage
+  {
+    // ----------------------- Types ------------------------------------------
+  public:
+    /// The type for vertex indices.
+    typedef unsigned int VertexIndex;
+    /// The type for sizes and offsets.
+    typedef std::size_t Size;
+    /// The type for an explicit face, i.e. its vertex indices.
+    typedef std::vector<VertexIndex> Face;
+
+    /**
+     * A view on the vertex indices of a face, given by a range of
+     * (possibly constant) indices.
+     * @tparam TIndex either VertexIndex or const VertexIndex.
+     */
+    template <typename TIndex>
+    class FaceView
+    {
+    public:
+      typedef TIndex*     iterator;
+      typedef TIndex*     const_iterator;
+      typedef VertexIndex value_type;
+      typedef TIndex&     reference;
+      typedef std::size_t size_type;
+
+      /// Default constructor (empty face).
+      FaceView() : myBegin( 0 ), myEnd( 0 ) {}
+      /// Constructor from a range of indices.
+      FaceView( TIndex* b, TIndex* e ) : myBegin( b ), myEnd( e ) {}
+      /// Conversion from a mutable view to a constant one.
+      template <typename TOtherIndex>
+      FaceView( const FaceView<TOtherIndex> & other )
+        : myBegin( other.begin() ), myEnd( other.end() ) {}
+
+      /// @return the number of vertices of the face.
+      Size size() const { return myEnd - myBegin; }
+      /// @return 'true' if the face has no vertex.
+      bool empty() const { return myBegin == myEnd; }
+      /// @return an iterator on the first vertex index.
+      TIndex* begin() const { return myBegin; }
+      /// @return an iterator after the last vertex index.
+      TIndex* end() const { return myEnd; }
+      /// @return a constant iterator on the first vertex index.
+      const VertexIndex* cbegin() const { return myBegin; }
+      /// @return a constant iterator after the last vertex index.
+      const VertexIndex* cend() const { return myEnd; }
+      /// @return the first vertex index.
+      TIndex& front() const { return *myBegin; }
+      /// @return the last vertex index.
+      TIndex& back() const { return *( myEnd - 1 ); }
+      /// @param i any index smaller than size().
+      /// @return the \a i-th vertex index.
+      TIndex& operator[]( Size i ) const { return myBegin[ i ]; }
+      /// @param i any index.
+      /// @return the \a i-th vertex index.
+      /// @throw std::out_of_range if \a i is not smaller than size().
+      TIndex& at( Size i ) const
+      {
+        if ( i >= size() ) throw std::out_of_range( "MeshFaceStorage::FaceView::at" );
+        return myBegin[ i ];
+      }
+      /// @return the explicit face, as a vector of vertex indices.
+      operator Face() const { return Face( myBegin, myEnd ); }
+
+    private:
+      TIndex* myBegin;
+      TIndex* myEnd;
+    };
+
+    /// Mutable view on a face.
+    typedef FaceView<VertexIndex>       View;
+    /// Constant view on a face.
+    typedef FaceView<const VertexIndex> ConstView;
+
+    /**
+     * Random-access iterator on the faces of a storage, whose
+     * dereferenced value is a view on a face.
+     * @tparam TIndex either VertexIndex or const VertexIndex.
+     */
+    template <typename TIndex>
+    class FaceIterator
+    {
+    public:
+      typedef typename std::conditional< std::is_const<TIndex>::value,
+                                         const MeshFaceStorage,
+                                         MeshFaceStorage >::type Storage;
+      typedef std::random_access_iterator_tag iterator_category;
+      typedef FaceView<TIndex>                value_type;
+      typedef std::ptrdiff_t                  difference_type;
+      typedef FaceView<TIndex>                reference;
+      /// Proxy returned by operator->.
+      struct pointer
+      {
+        FaceView<TIndex> myView;
+        const FaceView<TIndex>* operator->() const { return &myView; }
+      };
+
+      FaceIterator() : myStorage( 0 ), myIndex( 0 ) {}
+      FaceIterator( Storage* storage, Size i ) : myStorage( storage ), myIndex( i ) {}
+      /// Conversion from a mutable iterator to a constant one.
+      template <typename TOtherIndex>
+      FaceIterator( const FaceIterator<TOtherIndex> & other )
+        : myStorage( other.storage() ), myIndex( other.index() ) {}
+
+      reference operator*() const { return (*myStorage)[ myIndex ]; }
+      pointer operator->() const { pointer p = { (*myStorage)[ myIndex ] }; return p; }
+      reference operator[]( difference_type n ) const { return (*myStorage)[ myIndex + n ]; }
+      FaceIterator& operator++() { ++myIndex; return *this; }
+      FaceIterator  operator++( int ) { FaceIterator tmp( *this ); ++myIndex; return tmp; }
+      FaceIterator& operator--() { --myIndex; return *this; }
+      FaceIterator  operator--( int ) { FaceIterator tmp( *this ); --myIndex; return tmp; }
+      FaceIterator& operator+=( difference_type n ) { myIndex += n; return *this; }
+      FaceIterator& operator-=( difference_type n ) { myIndex -= n; return *this; }
+      FaceIterator  operator+( difference_type n ) const { return FaceIterator( myStorage, myIndex + n ); }
+      FaceIterator  operator-( difference_type n ) const { return FaceIterator( myStorage, myIndex - n ); }
+      difference_type operator-( const FaceIterator & other ) const
+      { return (difference_type) myIndex - (difference_type) other.myIndex; }
+      bool operator==( const FaceIterator & other ) const { return myIndex == other.myIndex; }
+      bool operator!=( const FaceIterator & other ) const { return myIndex != other.myIndex; }
+      bool operator<( const FaceIterator & other ) const { return myIndex < other.myIndex; }
+      bool operator>( const FaceIterator & other ) const { return myIndex > other.myIndex; }
+      bool operator<=( const FaceIterator & other ) const { return myIndex <= other.myIndex; }
+      bool operator>=( const FaceIterator & other ) const { return myIndex >= other.myIndex; }
+
+      /// @return the pointed storage.
+      Storage* storage() const { return myStorage; }
+      /// @return the index of the pointed face.
+      Size index() const { return myIndex; }
+
+    private:
+      Storage* myStorage;
+      Size     myIndex;
+    };
+
+    /// Mutable iterator on faces.
+    typedef FaceIterator<VertexIndex>       iterator;
+    /// Constant iterator on faces.
+    typedef FaceIterator<const VertexIndex> const_iterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /// Constructor of an empty storage.
+    MeshFaceStorage();
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /// @return the number of faces.
+    Size size() const;
+
+    /// @return 'true' if there is no face.
+    bool empty() const;
+
+    /// @return the total number of vertex indices of all the faces.
+    Size nbIndices() const;
+
+    /// @return 'true' if all the faces are triangles (offsets are implicit).
+    bool isTriangular() const;
+
+    /// Removes all the faces.
+    void clear();
+
+    /**
+     * Reserves memory for future faces.
+     * @param nbFaces the expected number of faces.
+     * @param nbIndices the expected total number of vertex indices.
+     */
+    void reserve( Size nbFaces, Size nbIndices );
+
+    /**
+     * @param i the index of a face.
+     * @return the offset of the first vertex index of face \a i in indices().
+     */
+    Size offset( Size i ) const;
+
+    /**
+     * @param i the index of a face.
+     * @return the number of vertices of face \a i.
+     */
+    Size faceSize( Size i ) const;
+
+    /// @return the vertex indices of all the faces, face after face.
+    const std::vector<VertexIndex> & indices() const;
+
+    /**
+     * @param i the index of a face.
+     * @return a view on face \a i.
+     */
+    ConstView operator[]( Size i ) const;
+
+    /**
+     * @param i the index of a face.
+     * @return a mutable view on face \a i.
+     */
+    View operator[]( Size i );
+
+    /**
+     * @param i the index of a face.
+     * @return a view on face \a i.
+     * @throw std::out_of_range if \a i is not smaller than size().
+     */
+    ConstView at( Size i ) const;
+
+    /**
+     * @param i the index of a face.
+     * @return a mutable view on face \a i.
+     * @throw std::out_of_range if \a i is not smaller than size().
+     */
+    View at( Size i );
+
+    /**
+     * Adds a face at the end.
+     * @param aFace the vertex indices of the face.
+     */
+    void push_back( const Face & aFace );
+
+    /**
+     * Adds a face at the end.
+     * @param itb an iterator on the first vertex index of the face.
+     * @param ite an iterator after the last vertex index of the face.
+     * @tparam TInputIterator a model of input iterator on indices.
+     */
+    template <typename TInputIterator>
+    void push_back( TInputIterator itb, TInputIterator ite );
+
+    /**
+     * Adds a triangle at the end.
+     * @param i0 the first vertex index.
+     * @param i1 the second vertex index.
+     * @param i2 the third vertex index.
+     */
+    void pushTriangle( VertexIndex i0, VertexIndex i1, VertexIndex i2 );
+
+    /**
+     * Adds faces with the same number of vertices at the end.
+     * @param itb an iterator on the first vertex index of the first face.
+     * @param ite an iterator after the last vertex index of the last face.
+     * @param faceSize the number of vertices of each face.
+     * @return the number of added faces.
+     * @tparam TInputIterator a model of input iterator on indices.
+     */
+    template <typename TInputIterator>
+    Size append( TInputIterator itb, TInputIterator ite, Size faceSize );
+
+    /**
+     * Adds all the faces of another storage at the end.
+     * @param other any face storage.
+     */
+    void append( const MeshFaceStorage & other );
+
+    /// @return an iterator on the first face.
+    const_iterator begin() const;
+    /// @return an iterator after the last face.
+    const_iterator end() const;
+    /// @return a mutable iterator on the first face.
+    iterator begin();
+    /// @return a mutable iterator after the last face.
+    iterator end();
+
+    /**
+     * Swaps the content with another storage.
+     * @param other any face storage.
+     */
+    void swap( MeshFaceStorage & other );
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The vertex indices of all the faces.
+    std::vector<VertexIndex> myIndices;
+    /// The offsets of the faces in myIndices (size()+1 values), or
+    /// empty while all the faces are triangles.
+    std::vector<Size> myOffsets;
+    /// The number of faces.
+    Size mySize;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+    /// Stores explicitly the offsets of the triangles.
+    void expandOffsets();
+
+  }; // end of class MeshFaceStorage
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'MeshFaceStorage'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'MeshFaceStorage' to write.
+   * @return the output stream after the writing.
+   */
+  std::ostream&
+  operator<< ( std::ostream & out, const MeshFaceStorage & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/shapes/MeshFaceStorage.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined MeshFaceStorage_h
+
+#undef MeshFaceStorage_RECURSES
+#endif // else defined(MeshFaceStorage_RECURSES)
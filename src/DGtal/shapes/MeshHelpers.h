@@ -48,6 +48,7 @@
 #include "DGtal/shapes/TriangulatedSurface.h"
 #include "DGtal/shapes/PolygonalSurface.h"
 #include "DGtal/shapes/Mesh.h"
+#include "DGtal/io/writers/MeshWriter.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -281,6 +282,56 @@ namespace DGtal
         const Color&                   diffuse_color  = Color( 200, 200, 255 ),
         const Color&                   specular_color = Color::White );
 
+    /// Exports a triangulated or polygonal surface as a binary PLY
+    /// file into the given output stream, with optional normals and
+    /// colors per vertex and per face. Each attribute is written only
+    /// if its vector has the right size.
+    ///
+    /// @tparam TTriangulatedOrPolygonalSurface either some TriangulatedSurface or some PolygonalSurface.
+    /// @param[in,out] output an output stream opened in binary mode.
+    /// @param[in]     polysurf the input triangulated or polygonal surface mesh.
+    /// @param[in]     vertex_normals either empty or a vector of size `polysurf.nbVertices()` specifying the normal vector at each vertex.
+    /// @param[in]     vertex_colors either empty or a vector of size `polysurf.nbVertices()` specifying the color of each vertex.
+    /// @param[in]     face_normals either empty or a vector of size `polysurf.nbFaces()` specifying the normal vector of each face.
+    /// @param[in]     face_colors either empty or a vector of size `polysurf.nbFaces()` specifying the color of each face.
+    template <typename TTriangulatedOrPolygonalSurface>
+      static
+      bool exportPLY
+      ( std::ostream& output,
+        const TTriangulatedOrPolygonalSurface& polysurf,
+        const std::vector< typename TTriangulatedOrPolygonalSurface::Point >& vertex_normals,
+        const std::vector< Color >& vertex_colors,
+        const std::vector< typename TTriangulatedOrPolygonalSurface::Point >& face_normals,
+        const std::vector< Color >& face_colors );
+
+    /// Exports a triangulated or polygonal surface as a binary STL
+    /// file into the given output stream. Polygonal faces are
+    /// triangulated as fans.
+    ///
+    /// @tparam TTriangulatedOrPolygonalSurface either some TriangulatedSurface or some PolygonalSurface.
+    /// @param[in,out] output an output stream opened in binary mode.
+    /// @param[in]     polysurf the input triangulated or polygonal surface mesh.
+    /// @param[in]     face_normals either empty or a vector of size `polysurf.nbFaces()` specifying the normal vector of each face.
+    template <typename TTriangulatedOrPolygonalSurface>
+      static
+      bool exportSTL
+      ( std::ostream& output,
+        const TTriangulatedOrPolygonalSurface& polysurf,
+        const std::vector< typename TTriangulatedOrPolygonalSurface::Point >& face_normals );
+
+    /// Builds the vertex positions and the faces of a triangulated or
+    /// polygonal surface, as expected by MeshWriter.
+    ///
+    /// @tparam TTriangulatedOrPolygonalSurface either some TriangulatedSurface or some PolygonalSurface.
+    /// @param[in]  polysurf the input triangulated or polygonal surface mesh.
+    /// @param[out] positions the position of each vertex.
+    /// @param[out] faces the vertices of each face.
+    template <typename TTriangulatedOrPolygonalSurface>
+      static
+      void surface2FaceStorage
+      ( const TTriangulatedOrPolygonalSurface& polysurf,
+        std::vector< typename TTriangulatedOrPolygonalSurface::Point >& positions,
+        MeshFaceStorage& faces );
     
     /// Exports a new material in a MTL stream.
     ///
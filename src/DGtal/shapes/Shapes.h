@@ -41,6 +41,7 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/NumberTraits.h"
 #include "DGtal/kernel/domains/CDomain.h"
@@ -105,6 +106,35 @@ namespace DGtal
     static void digitalShaper( TDigitalSet & aSet,
                                const TShapeFunctor & aFunctor);
 
+    /**
+     * Digitizes a shape into an image: each point of the image domain
+     * is given the value [anInsideValue] if the shape orientation is
+     * INSIDE or ON at this point, and [anOutsideValue] otherwise.
+     *
+     * The domain is cut into slabs along its last axis and, if DGtal
+     * is built with OpenMP, slabs are processed concurrently (the
+     * orientation() method of the shape must then be thread-safe,
+     * which is the case for all DGtal shapes). Values are then written
+     * in a single scan of the image range. The result is the same as
+     * a sequential scan of the domain.
+     *
+     * @param anImage the image (modified) whose domain is digitized.
+     * @param aFunctor a functor defining the shape.
+     * @param anInsideValue the value of points inside the shape.
+     * @param anOutsideValue the value of points outside the shape.
+     *
+     * @tparam TImage a model of CImage whose domain is a HyperRectDomain.
+     * @tparam TShapeFunctor a model of CDigitalOrientedShape (e.g. a
+     * GaussDigitizer).
+     */
+    template <typename TImage, typename TShapeFunctor>
+    static void imageShaper( TImage & anImage,
+                             const TShapeFunctor & aFunctor,
+                             const typename TImage::Value & anInsideValue
+                             = typename TImage::Value( 1 ),
+                             const typename TImage::Value & anOutsideValue
+                             = typename TImage::Value( 0 ) );
+
     /** 
      * Adds to the (perhaps non empty) set [aSet] an shape defined by
      * an instance of ShapeFunctor. Add Points where orientation is inside.
@@ -260,6 +290,21 @@ namespace DGtal
     // ------------------------- Internals ------------------------------------
   private:
 
+    /**
+     * Evaluates the orientation of a shape at every point of
+     * [aDomain], slab by slab (concurrently with OpenMP).
+     *
+     * @param aDomain a rectangular domain.
+     * @param aFunctor a functor defining the shape.
+     * @param[out] inside resized to aDomain.size(), inside[i] is
+     * non-zero iff the i-th point of the domain (in the domain
+     * scanning order) is INSIDE or ON the shape.
+     */
+    template <typename TShapeFunctor>
+    static void slabOrientations( const HyperRectDomain<Space> & aDomain,
+                                  const TShapeFunctor & aFunctor,
+                                  std::vector<unsigned char> & inside );
+
   }; // end of class Shapes
 
 
@@ -42,6 +42,9 @@
 // Inclusions
 #include <iostream>
 #include <array>
+#include <map>
+#include <set>
+#include <vector>
 #include "DGtal/base/Common.h"
 //////////////////////////////////////////////////////////////////////////////
 
@@ -234,27 +237,7 @@ namespace DGtal
     static Size getUnorderedEdgesFromTriangles
     ( const std::vector<Triangle>& triangles, std::vector< Edge >& edges_out )
     {
-      typedef std::set< Edge > EdgeSet;
-      typedef std::set< VertexIndex > VertexIndexSet;
-      VertexIndexSet vertexSet;
-      EdgeSet edgeSet;
-      for( const Triangle& T : triangles )
-        {
-          edgeSet.insert( Edge( T.i(), T.j() ) );
-          edgeSet.insert( Edge( T.j(), T.k() ) );
-          edgeSet.insert( Edge( T.k(), T.i() ) );
-          vertexSet.insert( T.i() );
-          vertexSet.insert( T.j() );
-          vertexSet.insert( T.k() );
-        }
-      edges_out.resize( edgeSet.size() );
-      Size e = 0;
-      for ( const Edge& edge : edgeSet )
-        {
-          edges_out.at(e) = edge;
-          ++e;
-        }
-      return vertexSet.size();
+      return getUnorderedEdgesFromFaces( triangles, edges_out );
     }
 
     /** 
@@ -333,13 +316,17 @@ namespace DGtal
      * triangles as well as the numbering of triangles in the vector
      * \a triangles.
      *
+     * The arcs of the triangles are sorted (by a parallel radix sort)
+     * according to their unoriented edge, instead of being inserted
+     * in maps, which gives the same half-edges, with the same
+     * numbering, as getUnorderedEdgesFromTriangles() followed by
+     * build( num_vertices, triangles, edges ).
+     *
      * @param[in] triangles the vector of input triangles.
      */
     bool build( const std::vector<Triangle>& triangles )
     {
-      std::vector<Edge> edges;
-      const Size nbVtx = getUnorderedEdgesFromTriangles( triangles, edges );
-      return build( nbVtx, triangles, edges );
+      return buildBySortingArcs( triangles );
     }
 
     /**
@@ -348,13 +335,16 @@ namespace DGtal
      * polygonal_faces as well as the numbering of faces in the vector
      * \a polygonal_faces.
      *
+     * As for triangles, the arcs of the faces are sorted by their
+     * unoriented edge, and the result is the same as
+     * getUnorderedEdgesFromPolygonalFaces() followed by
+     * build( num_vertices, polygonal_faces, edges ).
+     *
      * @param[in] polygonal_faces the vector of input polygonal faces.
      */
     bool build( const std::vector<PolygonalFace>& polygonal_faces )
     {
-      std::vector<Edge> edges;
-      const Size nbVtx = getUnorderedEdgesFromPolygonalFaces( polygonal_faces, edges );
-      return build( nbVtx, polygonal_faces, edges );
+      return buildBySortingArcs( polygonal_faces );
     }
 
     /// Clears the data structure.
@@ -1404,6 +1394,59 @@ namespace DGtal
     // ------------------------- Hidden services ------------------------------
   protected:
 
+    /// An arc identified by a sortable key, and the index of some
+    /// associated element (a face corner or an half-edge).
+    struct SortedArc
+    {
+      /// The key of the arc.
+      uint64_t key;
+      /// The index of the associated element.
+      Index index;
+    };
+
+    /// @return the number of vertices of the triangle (i.e. 3).
+    static Size faceSize( const Triangle& /* T */ ) { return 3; }
+    /// @return the \a k-th vertex of the triangle \a T.
+    static VertexIndex faceVertex( const Triangle& T, Size k ) { return T.v[ k ]; }
+    /// @return the number of vertices of the polygonal face \a P.
+    static Size faceSize( const PolygonalFace& P ) { return P.size(); }
+    /// @return the \a k-th vertex of the polygonal face \a P.
+    static VertexIndex faceVertex( const PolygonalFace& P, Size k ) { return P[ k ]; }
+
+    /**
+     * Sorts arcs by increasing keys (stable LSD radix sort, whose
+     * histograms and scatterings are computed in parallel with OpenMP).
+     *
+     * @param[in,out] arcs the arcs to sort.
+     * @param[in] maxKey an upper bound of the keys of the arcs.
+     */
+    static void radixSortArcs( std::vector<SortedArc>& arcs, uint64_t maxKey );
+
+    /**
+     * Computes all the unoriented edges of the given faces, sorted
+     * lexicographically, by sorting their vertex pairs.
+     *
+     * @param[in] faces the vector of input oriented faces (triangles or polygonal faces).
+     * @param[out] edges_out the vector of all the unoriented edges of the faces.
+     * @return the total number of different vertices.
+     */
+    template <typename TFace>
+    static Size getUnorderedEdgesFromFaces
+    ( const std::vector<TFace>& faces, std::vector< Edge >& edges_out );
+
+    /**
+     * Builds the half-edge data structure from the given faces, by
+     * sorting their arcs along their unoriented edges. Edges are
+     * numbered as in getUnorderedEdgesFromFaces, and half-edges, faces
+     * and vertices are linked as in build( num_vertices, faces, edges ).
+     *
+     * @param[in] faces the vector of input faces (triangles or polygonal faces).
+     * @return 'true' if everything went well, 'false' if their was
+     * error in the given topology.
+     */
+    template <typename TFace>
+    bool buildBySortingArcs( const std::vector<TFace>& faces );
+
     static
     FaceIndex arc2FaceIndex( const Arc2FaceIndex& de2fi,
                              VertexIndex vi, VertexIndex vj )
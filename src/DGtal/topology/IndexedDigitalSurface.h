@@ -272,6 +272,23 @@ namespace DGtal
     /// neighborhoods).
     bool build( ConstAlias< DigitalSurfaceContainer > surfContainer );
 
+    /// Builds the half-edge data structure from the given digital
+    /// surface container, like \ref build, but computes positions,
+    /// faces (umbrellas around pointels) and arc linels concurrently
+    /// (OpenMP). Vertices are numbered in increasing order of their
+    /// surfel, faces in increasing order of their pivot, so that the
+    /// result does not depend on the number of threads. Maps between
+    /// cells and indices are filled from sorted sequences.
+    ///
+    /// @param surfContainer any instance of digital surface
+    /// container. Pass a CountedPtr or any variant if you wish to
+    /// secure its aliasing.
+    ///
+    /// @return true if everything went allright, false if it was not
+    /// possible to build a consistent data structure (e.g., butterfly
+    /// neighborhoods).
+    bool buildInParallel( ConstAlias< DigitalSurfaceContainer > surfContainer );
+
     /**
        @return a const reference to the stored container.
     */
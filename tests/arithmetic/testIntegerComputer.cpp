@@ -30,6 +30,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include <cstdlib>
 #include <iostream>
+#include <sstream>
 #include "DGtal/base/Common.h"
 #include "DGtal/arithmetic/IntegerComputer.h"
 ///////////////////////////////////////////////////////////////////////////////
@@ -261,12 +262,12 @@ bool testValidBezout( const IntegerComputer<Integer> & ic )
  * Example of a test. To be completed.
  *
  */
+template <typename Integer>
 bool testIntegerComputer()
 {
   unsigned int nbtests = 50;
   unsigned int nbok = 0;
   unsigned int nb = 0;
-  typedef BigInteger Integer;
   IntegerComputer<Integer> ic;
   trace.beginBlock ( "Testing block: multiple random gcd." );
   for ( unsigned int i = 0; i < nbtests; ++i )
@@ -307,7 +308,7 @@ bool testIntegerComputer()
   trace.beginBlock ( "Testing block: multiple coefficient intersection." );
   for ( unsigned int i = 0; i < nbtests; ++i )
     {
-      nbok += testCoefficientIntersection( ic ) ? 1 : 0;
+      nbok += testCoefficientIntersection<Integer>( ic ) ? 1 : 0;
       nb++;
     }
   trace.info() << "(" << nbok << "/" << nb << ") coefficient intersection." << std::endl;
@@ -316,7 +317,7 @@ bool testIntegerComputer()
   trace.beginBlock ( "Testing block: multiple valid bezout." );
   for ( unsigned int i = 0; i < nbtests; ++i )
     {
-      nbok += testValidBezout( ic ) ? 1 : 0;
+      nbok += testValidBezout<Integer>( ic ) ? 1 : 0;
       nb++;
     }
   trace.info() << "(" << nbok << "/" << nb << ") valid bezout." << std::endl;
@@ -325,13 +326,92 @@ bool testIntegerComputer()
   return nbok == nb;
 }
 
+#ifdef DGTAL_HAS_INT128
+/// Converts a 128-bit integer to a big integer (through its decimal writing).
+BigInteger toBigInteger( DGtal::int128_t x )
+{
+  std::ostringstream out;
+  out << x;
+  return BigInteger( out.str() );
+}
+
+/// @return a random 128-bit integer with at most \a bits significant bits.
+DGtal::int128_t randomInt128( unsigned int bits )
+{
+  DGtal::uint128_t x = 0;
+  for ( unsigned int i = 0; i < 8; ++i )
+    x = ( x << 16 ) | (DGtal::uint128_t) ( rand() & 0xffff );
+  x >>= 128 - bits;
+  return ( rand() % 2 ) ? - (DGtal::int128_t) x : (DGtal::int128_t) x;
+}
+
+/**
+ * Compares the results of IntegerComputer<int128_t> with the ones
+ * of IntegerComputer<BigInteger>, on operands that fit or not in 64
+ * bits.
+ */
+bool testInt128VersusBigInteger()
+{
+  typedef DGtal::int128_t Integer;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  IntegerComputer<Integer> ic;
+  IntegerComputer<BigInteger> icb;
+  trace.beginBlock ( "Testing block: int128_t versus BigInteger." );
+  const unsigned int bits[] = { 20, 62, 63, 64, 65, 100, 120 };
+  for ( unsigned int i = 0; i < 7; ++i )
+    for ( unsigned int j = 0; j < 7; ++j )
+      for ( unsigned int k = 0; k < 20; ++k )
+        {
+          Integer a = randomInt128( bits[ i ] );
+          Integer b = randomInt128( bits[ j ] );
+          if ( b == 0 ) b = 1;
+          BigInteger ba = toBigInteger( a );
+          BigInteger bb = toBigInteger( b );
+          Integer q, r;
+          BigInteger bq, br;
+          ic.getEuclideanDiv( q, r, a, b );
+          icb.getEuclideanDiv( bq, br, ba, bb );
+          nbok += ( toBigInteger( q ) == bq && toBigInteger( r ) == br ) ? 1 : 0;
+          nbok += ( toBigInteger( ic.floorDiv( a, b ) ) == icb.floorDiv( ba, bb ) ) ? 1 : 0;
+          nbok += ( toBigInteger( ic.ceilDiv( a, b ) ) == icb.ceilDiv( ba, bb ) ) ? 1 : 0;
+          nbok += ( toBigInteger( ic.gcd( a, b ) ) == icb.gcd( ba, bb ) ) ? 1 : 0;
+          nb += 4;
+          if ( bits[ i ] <= 64 && bits[ j ] <= 64 )
+            { // the Bezout coefficients are bounded by |a| and |b|.
+              Integer g = ic.gcd( a, b );
+              IntegerComputer<Integer>::Vector2I v = ic.extendedEuclid( a, b, g );
+              nbok += ( a * v[ 0 ] + b * v[ 1 ] == g ) ? 1 : 0;
+              nb++;
+            }
+        }
+  trace.info() << "(" << nbok << "/" << nb << ") int128_t / BigInteger." << std::endl;
+  const Integer minimum = NumberTraits<Integer>::min();
+  std::ostringstream out;
+  out << minimum << " " << NumberTraits<Integer>::max();
+  nbok += out.str() == "-170141183460469231731687303715884105728 "
+                       "170141183460469231731687303715884105727" ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") output of "
+               << out.str() << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
 int main( int /*argc*/, char** /*argv*/ )
 {
   trace.beginBlock ( "Testing class IntegerComputer" );
-  bool res = testIntegerComputer(); // && ... other tests
+  bool res = testIntegerComputer<BigInteger>()
+    && testIntegerComputer<DGtal::int64_t>()
+#ifdef DGTAL_HAS_INT128
+    && testIntegerComputer<DGtal::int128_t>()
+    && testInt128VersusBigInteger()
+#endif
+    ; // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
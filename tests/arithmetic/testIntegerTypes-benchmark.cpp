@@ -0,0 +1,197 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testIntegerTypes-benchmark.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/19
+ *
+ * Compares the integer types DGtal::int64_t, DGtal::int128_t and
+ * DGtal::BigInteger for arithmetic DSS recognition and COBA naive
+ * plane recognition. Cases where 64-bit intermediate computations
+ * overflow are only run with int128_t and BigInteger.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/arithmetic/IntegerComputer.h"
+#include "DGtal/geometry/curves/ArithmeticalDSS.h"
+#include "DGtal/geometry/surfaces/COBANaivePlaneComputer.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking integer types.
+///////////////////////////////////////////////////////////////////////////////
+
+typedef PointVector<2, DGtal::int64_t> Point2;
+
+/// Random 64-bit integer in [0, m).
+DGtal::int64_t random64( DGtal::int64_t m )
+{
+  DGtal::uint64_t r = ( (DGtal::uint64_t) rand() << 32 ) ^ (DGtal::uint64_t) rand();
+  return (DGtal::int64_t) ( r % (DGtal::uint64_t) m );
+}
+
+/**
+ * Builds the points of naive digital straight lines of slopes a/b
+ * (0 <= a < b <= maxSlope) starting at abscissae up to maxOrigin.
+ */
+std::vector< std::vector< Point2 > >
+makeLines( unsigned int nblines, unsigned int length,
+           DGtal::int64_t maxSlope, DGtal::int64_t maxOrigin )
+{
+  IntegerComputer<BigInteger> ic;
+  std::vector< std::vector< Point2 > > lines( nblines );
+  for ( unsigned int i = 0; i < nblines; ++i )
+    {
+      BigInteger b = 2 + random64( maxSlope - 1 );
+      BigInteger a = random64( (DGtal::int64_t) b.get_si() );
+      BigInteger mu = random64( (DGtal::int64_t) b.get_si() );
+      DGtal::int64_t x0 = random64( maxOrigin );
+      for ( DGtal::int64_t x = x0; x < x0 + (DGtal::int64_t) length; ++x )
+        {
+          BigInteger y = ic.floorDiv( a * BigInteger( (long) x ) + mu, b );
+          lines[ i ].push_back( Point2( x, (DGtal::int64_t) y.get_si() ) );
+        }
+    }
+  return lines;
+}
+
+/// Recognizes each line as one DSS, returns the time in ms.
+template <typename Integer>
+double benchDSS( const std::string & name,
+                 const std::vector< std::vector< Point2 > > & lines, bool & ok )
+{
+  typedef ArithmeticalDSS<DGtal::int64_t, Integer, 8> DSS;
+  Clock c;
+  c.startClock();
+  for ( unsigned int i = 0; i < lines.size(); ++i )
+    {
+      DSS dss( lines[ i ].front() );
+      for ( unsigned int j = 1; j < lines[ i ].size(); ++j )
+        ok = dss.extendFront( lines[ i ][ j ] ) && ok;
+    }
+  const double t = c.stopClock();
+  trace.info() << "DSS   " << name << ": " << t << " ms "
+               << ( ok ? "" : "[ERROR]" ) << std::endl;
+  return t;
+}
+
+/// Recognizes random naive planes, returns the time in ms.
+template <typename Integer>
+double benchCOBA( const std::string & name, unsigned int nbplanes,
+                  unsigned int nbpoints, int diameter, bool & ok )
+{
+  typedef COBANaivePlaneComputer<Z3i::Space, Integer> Plane;
+  typedef IntegerComputer<BigInteger> IC;
+  IC ic;
+  srand( 0 );
+  Clock c;
+  double t = 0.0;
+  for ( unsigned int k = 0; k < nbplanes; ++k )
+    {
+      // Axis 0 is the main axis: |a| >= |b|, |c|.
+      const DGtal::int64_t ma = 1 + random64( diameter / 2 );
+      BigInteger a = ma;
+      BigInteger b = random64( ma + 1 );
+      BigInteger cc = random64( ma + 1 );
+      BigInteger d = random64( diameter / 2 );
+      std::vector< Z3i::Point > points( nbpoints );
+      for ( unsigned int i = 0; i < nbpoints; ++i )
+        {
+          Z3i::Point & p = points[ i ];
+          p[ 1 ] = (int) random64( 2 * diameter ) - diameter;
+          p[ 2 ] = (int) random64( 2 * diameter ) - diameter;
+          p[ 0 ] = (int) ic.ceilDiv( d - b * p[ 1 ] - cc * p[ 2 ], a ).get_si();
+        }
+      c.startClock();
+      Plane plane;
+      plane.init( 0, diameter, 1, 1 );
+      for ( unsigned int i = 0; i < nbpoints; ++i )
+        ok = plane.extend( points[ i ] ) && ok;
+      t += c.stopClock();
+    }
+  trace.info() << "COBA  " << name << ": " << t << " ms "
+               << ( ok ? "" : "[ERROR]" ) << std::endl;
+  return t;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  unsigned int nblines  = ( argc > 1 ) ? atoi( argv[ 1 ] ) : 1000;
+  unsigned int nbplanes = ( argc > 2 ) ? atoi( argv[ 2 ] ) : 100;
+  std::cout << "# Usage: " << argv[0] << " <nblines> <nbplanes>." << std::endl;
+  bool res = true;
+
+  trace.beginBlock ( "DSS recognition, slopes < 2^20, origins < 2^30" );
+  {
+    srand( 0 );
+    std::vector< std::vector< Point2 > > lines
+      = makeLines( nblines, 1000, 1 << 20, 1 << 30 );
+    benchDSS<DGtal::int64_t>( "int64_t   ", lines, res );
+#ifdef DGTAL_HAS_INT128
+    benchDSS<DGtal::int128_t>( "int128_t  ", lines, res );
+#endif
+    benchDSS<BigInteger>( "BigInteger", lines, res );
+  }
+  trace.endBlock();
+
+#ifdef DGTAL_HAS_INT128
+  trace.beginBlock ( "DSS recognition, slopes < 2^32, origins < 2^40 (int64_t overflows)" );
+  {
+    srand( 1 );
+    std::vector< std::vector< Point2 > > lines
+      = makeLines( nblines, 1000, 1LL << 32, 1LL << 40 );
+    benchDSS<DGtal::int128_t>( "int128_t  ", lines, res );
+    benchDSS<BigInteger>( "BigInteger", lines, res );
+  }
+  trace.endBlock();
+#endif
+
+  trace.beginBlock ( "COBA naive planes, diameter 100" );
+  benchCOBA<DGtal::int64_t>( "int64_t   ", nbplanes, 100, 100, res );
+#ifdef DGTAL_HAS_INT128
+  benchCOBA<DGtal::int128_t>( "int128_t  ", nbplanes, 100, 100, res );
+#endif
+  benchCOBA<BigInteger>( "BigInteger", nbplanes, 100, 100, res );
+  trace.endBlock();
+
+#ifdef DGTAL_HAS_INT128
+  trace.beginBlock ( "COBA naive planes, diameter 5000 (int64_t overflows)" );
+  benchCOBA<DGtal::int128_t>( "int128_t  ", nbplanes, 100, 5000, res );
+  benchCOBA<BigInteger>( "BigInteger", nbplanes, 100, 5000, res );
+  trace.endBlock();
+#endif
+
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,175 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testDiscreteExteriorCalculusAssembly.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/19
+ *
+ * Tests the parallel assembly and the memoization of the operators of
+ * DiscreteExteriorCalculus.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/math/linalg/EigenSupport.h"
+#include "DGtal/dec/DiscreteExteriorCalculus.h"
+#include "DGtal/dec/DiscreteExteriorCalculusFactory.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef DiscreteExteriorCalculus<3, 3, EigenLinearAlgebraBackend> Calculus;
+typedef DiscreteExteriorCalculusFactory<EigenLinearAlgebraBackend> CalculusFactory;
+typedef Calculus::SparseMatrix SparseMatrix;
+
+/// @return the calculus of a digital ball of radius \a r.
+Calculus makeBallCalculus( int r )
+{
+  const Z3i::Domain domain( Z3i::Point::diagonal( -r-1 ), Z3i::Point::diagonal( r+1 ) );
+  Z3i::DigitalSet set( domain );
+  for ( auto p : domain )
+    if ( p.squaredNorm() <= r*r ) set.insertNew( p );
+  return CalculusFactory::createFromDigitalSet( set );
+}
+
+/// @return 'true' if both matrices are equal up to \a epsilon.
+bool isEqual( const SparseMatrix& a, const SparseMatrix& b, double epsilon = 1e-12 )
+{
+  if ( a.rows() != b.rows() || a.cols() != b.cols() ) return false;
+  const SparseMatrix c = a - b;
+  for ( int k = 0; k < c.outerSize(); ++k )
+    for ( SparseMatrix::InnerIterator it( c, k ); it; ++it )
+      if ( std::abs( it.value() ) > epsilon ) return false;
+  return true;
+}
+
+/// Returns all the operators of \a calculus, to check them against each other.
+std::vector< SparseMatrix > allOperators( const Calculus& calculus )
+{
+  std::vector< SparseMatrix > ops;
+  ops.push_back( calculus.derivative<0, PRIMAL>().myContainer );
+  ops.push_back( calculus.derivative<1, PRIMAL>().myContainer );
+  ops.push_back( calculus.derivative<2, PRIMAL>().myContainer );
+  ops.push_back( calculus.derivative<0, DUAL>().myContainer );
+  ops.push_back( calculus.derivative<1, DUAL>().myContainer );
+  ops.push_back( calculus.hodge<0, PRIMAL>().myContainer );
+  ops.push_back( calculus.hodge<1, PRIMAL>().myContainer );
+  ops.push_back( calculus.hodge<2, DUAL>().myContainer );
+  ops.push_back( calculus.laplace<PRIMAL>().myContainer );
+  ops.push_back( calculus.laplace<DUAL>().myContainer );
+  for ( Dimension dir = 0; dir < 3; dir++ )
+    {
+      ops.push_back( calculus.sharpDirectional<PRIMAL>( dir ).myContainer );
+      ops.push_back( calculus.flatDirectional<DUAL>( dir ).myContainer );
+    }
+  return ops;
+}
+
+SCENARIO( "DiscreteExteriorCalculus operators assembly", "[dec][assembly]" )
+{
+  Calculus calculus = makeBallCalculus( 5 );
+  GIVEN( "The operators of a digital ball" ) {
+    const Calculus::PrimalDerivative0 d0 = calculus.derivative<0, PRIMAL>();
+    const Calculus::PrimalDerivative1 d1 = calculus.derivative<1, PRIMAL>();
+    THEN( "The derivative of the derivative is zero" ) {
+      const SparseMatrix dd = d1.myContainer * d0.myContainer;
+      REQUIRE( isEqual( dd, SparseMatrix( dd.rows(), dd.cols() ) ) );
+      REQUIRE( d0.myContainer.nonZeros() == 2 * d0.myContainer.rows() );
+    }
+    THEN( "The Laplace operator is the composition of the antiderivative and derivative" ) {
+      const Calculus::PrimalAntiderivative1 ad1 = calculus.antiderivative<1, PRIMAL>();
+      const SparseMatrix composed = ad1.myContainer * d0.myContainer;
+      REQUIRE( isEqual( calculus.laplace<PRIMAL>().myContainer, composed ) );
+      REQUIRE( isEqual( calculus.laplace<PRIMAL>().myContainer, composed ) );
+    }
+  }
+  GIVEN( "Memoized operators" ) {
+    REQUIRE( ! calculus.isOperatorMemoizationEnabled() );
+    const std::vector< SparseMatrix > assembled_ops = allOperators( calculus );
+    calculus.setOperatorMemoization( true );
+    THEN( "They are the operators assembled without memoization" ) {
+      const std::vector< SparseMatrix > first_ops  = allOperators( calculus );
+      const std::vector< SparseMatrix > second_ops = allOperators( calculus );
+      REQUIRE( first_ops.size() == assembled_ops.size() );
+      for ( std::size_t i = 0; i < assembled_ops.size(); i++ )
+        {
+          REQUIRE( isEqual( first_ops[ i ], assembled_ops[ i ], 0.0 ) );
+          REQUIRE( isEqual( second_ops[ i ], assembled_ops[ i ], 0.0 ) );
+        }
+    }
+    THEN( "They can be requested concurrently" ) {
+      const Calculus& const_calculus = calculus;
+      std::vector< SparseMatrix > laplaces( 8 );
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+      for ( int i = 0; i < 8; i++ )
+        laplaces[ i ] = const_calculus.laplace<PRIMAL>().myContainer;
+      for ( int i = 0; i < 8; i++ )
+        REQUIRE( isEqual( laplaces[ i ], assembled_ops[ 8 ], 0.0 ) );
+    }
+    const SparseMatrix laplace_before = calculus.laplace<DUAL>().myContainer;
+    const SparseMatrix hodge_before   = calculus.hodge<0, DUAL>().myContainer;
+    const SparseMatrix primal_hodge_before = calculus.hodge<0, PRIMAL>().myContainer;
+    THEN( "Resetting sizes invalidates them" ) {
+      calculus.resetSizes();
+      REQUIRE( ! isEqual( calculus.hodge<0, PRIMAL>().myContainer, primal_hodge_before ) );
+      REQUIRE( ! isEqual( calculus.laplace<DUAL>().myContainer, laplace_before ) );
+      const SparseMatrix composed = calculus.antiderivative<1, DUAL>().myContainer
+        * calculus.derivative<0, DUAL>().myContainer;
+      REQUIRE( isEqual( calculus.laplace<DUAL>().myContainer, composed ) );
+    }
+    THEN( "Erasing a cell invalidates them" ) {
+      const Calculus::Cell cell = calculus.myKSpace.unsigns( calculus.getSCell( 0, DUAL, 0 ) );
+      REQUIRE( calculus.eraseCell( cell ) );
+      calculus.updateIndexes();
+      REQUIRE( calculus.laplace<DUAL>().myContainer.rows() == laplace_before.rows() - 1 );
+      REQUIRE( calculus.hodge<0, DUAL>().myContainer.rows() == hodge_before.rows() - 1 );
+    }
+  }
+#ifdef WITH_OPENMP
+  GIVEN( "Operators assembled with different numbers of threads" ) {
+    const int nb_threads = omp_get_max_threads();
+    omp_set_num_threads( 1 );
+    const Calculus sequential = makeBallCalculus( 5 );
+    const std::vector< SparseMatrix > seq_ops = allOperators( sequential );
+    omp_set_num_threads( 4 );
+    const Calculus parallel = makeBallCalculus( 5 );
+    const std::vector< SparseMatrix > par_ops = allOperators( parallel );
+    omp_set_num_threads( nb_threads );
+    THEN( "They are identical" ) {
+      REQUIRE( seq_ops.size() == par_ops.size() );
+      for ( std::size_t i = 0; i < seq_ops.size(); i++ )
+        REQUIRE( isEqual( seq_ops[ i ], par_ops[ i ], 0.0 ) );
+    }
+  }
+#endif
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,120 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testDiscreteExteriorCalculusMultigrid-benchmark.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/19
+ *
+ * Solves the dual Poisson problem of a digital ball with the direct
+ * LDLT solver, the conjugate gradient and the multigrid preconditioned
+ * conjugate gradient. The ball radius (default 20) may be given as
+ * first argument. A second argument equal to 0 skips the direct solver
+ * (e.g. for radii above 25).
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/math/linalg/EigenSupport.h"
+#include "DGtal/dec/DiscreteExteriorCalculus.h"
+#include "DGtal/dec/DiscreteExteriorCalculusFactory.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef DiscreteExteriorCalculus<3, 3, EigenLinearAlgebraBackend> Calculus;
+typedef DiscreteExteriorCalculusFactory<EigenLinearAlgebraBackend> CalculusFactory;
+typedef EigenLinearAlgebraBackend::DenseVector DenseVector;
+typedef EigenLinearAlgebraBackend::SparseMatrix SparseMatrix;
+
+/// Solves A x = b with \a solver and displays the residual.
+template <typename Solver>
+DenseVector solveAndCheck( Solver& solver, const SparseMatrix& A, const DenseVector& b )
+{
+  trace.beginBlock( "Compute" );
+  solver.compute( A );
+  trace.endBlock();
+  trace.beginBlock( "Solve" );
+  const DenseVector x = solver.solve( b );
+  trace.endBlock();
+  trace.info() << "info=" << solver.info()
+               << " residual=" << ( b - A * x ).norm() / b.norm() << std::endl;
+  return x;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  const int r = ( argc > 1 ) ? atoi( argv[ 1 ] ) : 20;
+  const bool with_direct = ( argc > 2 ) ? atoi( argv[ 2 ] ) != 0 : true;
+  trace.beginBlock ( "Benchmarking multigrid solvers on dual Poisson problems" );
+
+  trace.beginBlock( "Calculus and Laplace operator" );
+  const Z3i::Domain domain( Z3i::Point::diagonal( -r-1 ), Z3i::Point::diagonal( r+1 ) );
+  Z3i::DigitalSet set( domain );
+  for ( auto p : domain )
+    if ( p.squaredNorm() <= r*r ) set.insertNew( p );
+  const Calculus calculus = CalculusFactory::createFromDigitalSet( set );
+  const SparseMatrix laplace = calculus.laplace<DUAL>().myContainer;
+  DenseVector b = DenseVector::Zero( laplace.rows() );
+  b( b.rows() / 3 )     = 1.0;
+  b( 2 * b.rows() / 3 ) = -1.0;
+  trace.info() << "Ball of radius " << r << ", " << laplace.rows() << " unknowns" << std::endl;
+  trace.endBlock();
+
+  if ( with_direct )
+    {
+      trace.beginBlock( "Simplicial LDLT" );
+      EigenLinearAlgebraBackend::SolverSimplicialLDLT solver;
+      solveAndCheck( solver, laplace, b );
+      trace.endBlock();
+    }
+
+  {
+    trace.beginBlock( "Conjugate gradient" );
+    EigenLinearAlgebraBackend::SolverConjugateGradient solver;
+    solver.setTolerance( 1e-8 );
+    solveAndCheck( solver, laplace, b );
+    trace.info() << "iterations=" << solver.iterations() << std::endl;
+    trace.endBlock();
+  }
+
+  bool ok = true;
+  {
+    trace.beginBlock( "Multigrid conjugate gradient" );
+    EigenLinearAlgebraBackend::SolverMultigridConjugateGradient solver;
+    solver.setTolerance( 1e-8 );
+    solveAndCheck( solver, laplace, b );
+    trace.info() << "iterations=" << solver.iterations()
+                 << " " << solver.preconditioner() << std::endl;
+    ok = solver.info() == Eigen::Success;
+    trace.endBlock();
+  }
+  trace.endBlock();
+  return ok ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
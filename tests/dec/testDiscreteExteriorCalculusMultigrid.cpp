@@ -0,0 +1,170 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testDiscreteExteriorCalculusMultigrid.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/19
+ *
+ * Tests the multigrid preconditioned solvers of
+ * EigenLinearAlgebraBackend on Poisson problems of digital sets.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/math/linalg/EigenSupport.h"
+#include "DGtal/dec/DiscreteExteriorCalculus.h"
+#include "DGtal/dec/DiscreteExteriorCalculusFactory.h"
+#include "DGtal/dec/DiscreteExteriorCalculusSolver.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef DiscreteExteriorCalculusFactory<EigenLinearAlgebraBackend> CalculusFactory;
+typedef EigenLinearAlgebraBackend::DenseVector DenseVector;
+
+/// @return the calculus of a digital ball of radius \a r.
+template <typename Space>
+DiscreteExteriorCalculus<Space::dimension, Space::dimension, EigenLinearAlgebraBackend>
+makeBallCalculus( int r )
+{
+  typedef HyperRectDomain<Space> Domain;
+  typedef typename Space::Point Point;
+  const Domain domain( Point::diagonal( -r-1 ), Point::diagonal( r+1 ) );
+  DigitalSetBySTLVector<Domain> set( domain );
+  for ( auto p : domain )
+    if ( p.squaredNorm() <= r*r ) set.insertNew( p );
+  return CalculusFactory::createFromDigitalSet( set );
+}
+
+/// Solves the Poisson problem of \a calculus with a direct and a
+/// multigrid solver and returns their relative difference.
+template <typename Calculus, typename LinearAlgebraSolver>
+double poissonDifference( const Calculus& calculus, LinearAlgebraSolver& mg_solver )
+{
+  typedef typename Calculus::DualIdentity0 Laplace;
+  typedef typename Calculus::DualForm0 Form;
+  typedef DiscreteExteriorCalculusSolver<Calculus, EigenLinearAlgebraBackend::SolverSimplicialLDLT,
+                                         0, DUAL, 0, DUAL> DirectSolver;
+  const Laplace laplace = calculus.template laplace<DUAL>()
+    + 0.01 * calculus.template identity<0, DUAL>();
+  Form dirac( calculus );
+  dirac.myContainer( dirac.length() / 3 ) = 1;
+  dirac.myContainer( 2 * dirac.length() / 3 ) = -0.5;
+
+  DirectSolver direct;
+  direct.compute( laplace );
+  const Form expected = direct.solve( dirac );
+
+  mg_solver.setTolerance( 1e-10 );
+  mg_solver.compute( laplace.myContainer );
+  const DenseVector solution = mg_solver.solve( dirac.myContainer );
+  return ( solution - expected.myContainer ).norm() / expected.myContainer.norm();
+}
+
+SCENARIO( "EigenMultigridPreconditioner hierarchy", "[dec][multigrid]" )
+{
+  typedef DiscreteExteriorCalculus<3, 3, EigenLinearAlgebraBackend> Calculus;
+  const Calculus calculus = makeBallCalculus<Z3i::Space>( 8 );
+  const Calculus::DualIdentity0 laplace = calculus.laplace<DUAL>();
+  EigenMultigridPreconditioner<double> preconditioner;
+  preconditioner.setCoarsestSize( 50 );
+  preconditioner.compute( laplace.myContainer );
+  THEN( "Levels are coarser and coarser" ) {
+    REQUIRE( preconditioner.info() == Eigen::Success );
+    REQUIRE( preconditioner.isValid() );
+    REQUIRE( preconditioner.rows() == laplace.myContainer.rows() );
+    REQUIRE( preconditioner.nbLevels() >= 3 );
+    for ( Eigen::Index l = 1; l < preconditioner.nbLevels(); l++ )
+      REQUIRE( 2 * preconditioner.levelSize( l ) < preconditioner.levelSize( l-1 ) );
+    REQUIRE( preconditioner.levelSize( preconditioner.nbLevels() - 1 ) <= 50 );
+  }
+  THEN( "One V-cycle reduces the residual" ) {
+    const DenseVector b = DenseVector::Ones( laplace.myContainer.rows() );
+    const DenseVector x = preconditioner.solve( b );
+    REQUIRE( ( b - laplace.myContainer * x ).norm() < 0.5 * b.norm() );
+  }
+  THEN( "A matrix with a zero diagonal is rejected" ) {
+    EigenLinearAlgebraBackend::SparseMatrix zero( 3, 3 );
+    zero.insert( 0, 1 ) = 1;
+    EigenMultigridPreconditioner<double> other;
+    other.compute( zero );
+    REQUIRE( other.info() == Eigen::NumericalIssue );
+    REQUIRE( ! other.isValid() );
+  }
+}
+
+SCENARIO( "Multigrid solvers on Poisson problems", "[dec][multigrid]" )
+{
+  GIVEN( "A 3D digital ball" ) {
+    typedef DiscreteExteriorCalculus<3, 3, EigenLinearAlgebraBackend> Calculus;
+    const Calculus calculus = makeBallCalculus<Z3i::Space>( 10 );
+    THEN( "Multigrid conjugate gradient matches the direct solver" ) {
+      EigenLinearAlgebraBackend::SolverMultigridConjugateGradient solver;
+      solver.preconditioner().setCoarsestSize( 100 );
+      REQUIRE( poissonDifference( calculus, solver ) < 1e-6 );
+      REQUIRE( solver.info() == Eigen::Success );
+      REQUIRE( solver.preconditioner().nbLevels() >= 2 );
+      REQUIRE( solver.iterations() < 30 );
+    }
+    THEN( "Multigrid BiCGSTAB matches the direct solver" ) {
+      EigenLinearAlgebraBackend::SolverMultigridBiCGSTAB solver;
+      solver.preconditioner().setCoarsestSize( 100 );
+      REQUIRE( poissonDifference( calculus, solver ) < 1e-6 );
+      REQUIRE( solver.info() == Eigen::Success );
+    }
+  }
+  GIVEN( "A 2D digital disk" ) {
+    typedef DiscreteExteriorCalculus<2, 2, EigenLinearAlgebraBackend> Calculus;
+    const Calculus calculus = makeBallCalculus<Z2i::Space>( 40 );
+    THEN( "Multigrid conjugate gradient matches the direct solver" ) {
+      EigenLinearAlgebraBackend::SolverMultigridConjugateGradient solver;
+      solver.preconditioner().setCoarsestSize( 100 );
+      REQUIRE( poissonDifference( calculus, solver ) < 1e-6 );
+      REQUIRE( solver.info() == Eigen::Success );
+      REQUIRE( solver.iterations() < 30 );
+    }
+  }
+  GIVEN( "A multigrid solver used through DiscreteExteriorCalculusSolver" ) {
+    typedef DiscreteExteriorCalculus<3, 3, EigenLinearAlgebraBackend> Calculus;
+    typedef DiscreteExteriorCalculusSolver<Calculus,
+            EigenLinearAlgebraBackend::SolverMultigridConjugateGradient,
+            0, DUAL, 0, DUAL> Solver;
+    const Calculus calculus = makeBallCalculus<Z3i::Space>( 6 );
+    const Calculus::DualIdentity0 laplace = calculus.laplace<DUAL>();
+    Calculus::DualForm0 input( calculus );
+    input.myContainer.setOnes();
+    Solver solver;
+    solver.compute( laplace );
+    const Calculus::DualForm0 solution = solver.solve( input );
+    THEN( "The Laplace equation is solved" ) {
+      REQUIRE( solver.isValid() );
+      const DenseVector residual = input.myContainer - laplace.myContainer * solution.myContainer;
+      REQUIRE( residual.norm() < 1e-6 * input.myContainer.norm() );
+    }
+  }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,165 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testGeodesicsInHeat.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/19
+ *
+ * Tests geodesic distances computed by the heat method (class
+ * GeodesicsInHeat and ShortcutsGeometry services).
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cmath>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/helpers/Shortcuts.h"
+#include "DGtal/helpers/ShortcutsGeometry.h"
+#include "DGtal/dec/DiscreteExteriorCalculusFactory.h"
+#include "DGtal/dec/GeodesicsInHeat.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef DiscreteExteriorCalculusFactory<EigenLinearAlgebraBackend> CalculusFactory;
+typedef Shortcuts<Z3i::KSpace>         SH3;
+typedef ShortcutsGeometry<Z3i::KSpace> SHG3;
+
+SCENARIO( "GeodesicsInHeat on a 2D grid", "[dec][geodesics]" )
+{
+  const int n = 40;
+  const Z2i::Domain domain( Z2i::Point( 0, 0 ), Z2i::Point( n, n ) );
+  Z2i::DigitalSet set( domain );
+  for ( auto p : domain ) set.insertNew( p );
+  const auto calculus = CalculusFactory::createFromDigitalSet( set, false );
+  const GeodesicsInHeat<Z2i::KSpace> heat( calculus, 1.0 );
+  const Z2i::Point c( n/2, n/2 );
+  const auto d = heat.compute( { heat.index( calculus.myKSpace.sSpel( c ) ) } );
+  THEN( "Distances approximate Euclidean distances" ) {
+    REQUIRE( heat.isValid() );
+    REQUIRE( d.myContainer( heat.index( calculus.myKSpace.sSpel( c ) ) ) == Approx( 0.0 ) );
+    for ( auto p : domain )
+      {
+        const double e = ( p - c ).norm();
+        const double g = d.myContainer( heat.index( calculus.myKSpace.sSpel( p ) ) );
+        // The error is about the size of a cell, wherever the cell is.
+        REQUIRE( std::abs( g - e ) < 1.0 );
+      }
+  }
+  THEN( "Invalid source indices are ignored" ) {
+    const auto s = heat.index( calculus.myKSpace.sSpel( c ) );
+    const auto d2 = heat.compute( { -1, s, heat.size() } );
+    REQUIRE( ( d2.myContainer - d.myContainer ).lpNorm<Eigen::Infinity>() < 1e-12 );
+    REQUIRE( heat.compute( { heat.size() } ).myContainer.isZero() );
+  }
+}
+
+SCENARIO( "GeodesicsInHeat on digital surfaces", "[dec][geodesics]" )
+{
+  GIVEN( "The surface of a digital cube" ) {
+    const int n = 10;
+    const Z3i::Domain domain( Z3i::Point::diagonal( -n-2 ), Z3i::Point::diagonal( n+2 ) );
+    auto params  = SH3::defaultParameters() | SHG3::defaultParameters();
+    params( "verbose", 0 );
+    auto bimage  = SH3::makeBinaryImage( domain );
+    for ( auto p : domain ) bimage->setValue( p, p.normInfinity() <= n );
+    auto K       = SH3::getKSpace( bimage, params );
+    auto surface = SH3::makeLightDigitalSurface( bimage, K, params );
+    auto surfels = SH3::getSurfelRange( surface, params );
+    auto heat    = SHG3::makeGeodesicsInHeat( surface, surfels, params );
+    // The surfel at the center of the top face.
+    const Z3i::SCell source = K.sCell( Z3i::Point( 1, 1, 2*n+2 ), K.POS );
+    const auto distances = SHG3::getGeodesicDistances( heat, surfels, SH3::SurfelRange( 1, source ), params );
+    const auto embedder  = SH3::getSCellEmbedder( K );
+    THEN( "Distances are isotropic on a face" ) {
+      REQUIRE( heat->isValid() );
+      REQUIRE( distances.size() == surfels.size() );
+      std::map< std::pair<double,double>, double > top;
+      for ( std::size_t i = 0; i < surfels.size(); ++i )
+        {
+          const auto p = embedder( surfels[ i ] );
+          if ( p[ 2 ] > n ) top[ { p[ 0 ], p[ 1 ] } ] = distances[ i ];
+        }
+      REQUIRE( top.size() == std::size_t( ( 2*n+1 ) * ( 2*n+1 ) ) );
+      REQUIRE( top[ { 0.0, 0.0 } ] == Approx( 0.0 ) );
+      for ( int x = 4; x <= n; x += 2 )
+        for ( int y = 0; y < x; y += 2 )
+          {
+            REQUIRE( top[ { double( x ), double( y ) } ]
+                     == Approx( top[ { double( y ), double( x ) } ] ).margin( 0.1 ) );
+            REQUIRE( top[ { double( x ), double( y ) } ]
+                     == Approx( top[ { double( -x ), double( -y ) } ] ).margin( 0.1 ) );
+          }
+    }
+    THEN( "Batched queries give the same distances as single queries" ) {
+      std::vector< SH3::SurfelRange > sources;
+      for ( std::size_t i = 0; i < surfels.size(); i += surfels.size() / 7 )
+        sources.push_back( SH3::SurfelRange( 1, surfels[ i ] ) );
+      sources.push_back( SH3::SurfelRange( { surfels[ 0 ], surfels[ 100 ], source } ) );
+      const auto batch = SHG3::getGeodesicDistances( heat, surfels, sources, params );
+      REQUIRE( batch.size() == sources.size() );
+      for ( std::size_t k = 0; k < sources.size(); ++k )
+        {
+          const auto single = SHG3::getGeodesicDistances( heat, surfels, sources[ k ], params );
+          REQUIRE( single == batch[ k ] );
+        }
+      // Distances to several sources are (about) the minimum of
+      // distances to each.
+      const auto& several = batch.back();
+      for ( std::size_t i = 0; i < surfels.size(); ++i )
+        REQUIRE( several[ i ] <= 1.05 * distances[ i ] + 0.5 );
+    }
+  }
+  GIVEN( "The surface of a digitized sphere" ) {
+    auto params  = SH3::defaultParameters() | SHG3::defaultParameters();
+    params( "polynomial", "sphere1" )( "gridstep", 0.1 )( "verbose", 0 );
+    auto shape   = SH3::makeImplicitShape3D( params );
+    auto K       = SH3::getKSpace( params );
+    auto dshape  = SH3::makeDigitizedImplicitShape3D( shape, params );
+    auto bimage  = SH3::makeBinaryImage( dshape, params );
+    auto surface = SH3::makeLightDigitalSurface( bimage, K, params );
+    auto surfels = SH3::getSurfelRange( surface, params );
+    auto heat    = SHG3::makeGeodesicsInHeat( surface, surfels, params );
+    const auto distances = SHG3::getGeodesicDistances( heat, surfels, SH3::SurfelRange( 1, surfels[ 0 ] ), params );
+    const auto positions = SHG3::getPositions( shape, K, surfels, params );
+    THEN( "Distances approximate great-circle distances" ) {
+      const auto p0 = positions[ 0 ] / positions[ 0 ].norm();
+      double max_d = 0.0;
+      for ( std::size_t i = 0; i < surfels.size(); ++i )
+        {
+          const auto   p = positions[ i ] / positions[ i ].norm();
+          const double g = std::acos( std::max( -1.0, std::min( 1.0, p.dot( p0 ) ) ) );
+          max_d = std::max( max_d, distances[ i ] );
+          // Digital surfaces are staircases, which are longer than
+          // the smooth sphere.
+          REQUIRE( distances[ i ] >= 0.8 * g - 0.1 );
+          REQUIRE( distances[ i ] <= 1.3 * g + 0.1 );
+        }
+      REQUIRE( max_d >= M_PI );
+    }
+  }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,218 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testMatrixFreeLinearOperator.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/19
+ *
+ * Tests matrix-free DEC operators (class MatrixFreeLinearOperator)
+ * against explicit sparse operators and direct solvers.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/math/linalg/EigenSupport.h"
+#include "DGtal/dec/DiscreteExteriorCalculus.h"
+#include "DGtal/dec/DiscreteExteriorCalculusFactory.h"
+#include "DGtal/dec/DiscreteExteriorCalculusSolver.h"
+#include "DGtal/dec/DECHelpers.h"
+#include "DGtal/dec/MatrixFreeLinearOperator.h"
+#include "DGtal/dec/ATSolver2D.h"
+#include "DGtal/helpers/Shortcuts.h"
+#include "DGtal/helpers/ShortcutsGeometry.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef DiscreteExteriorCalculus<2, 2, EigenLinearAlgebraBackend> Calculus;
+typedef DiscreteExteriorCalculusFactory<EigenLinearAlgebraBackend> CalculusFactory;
+typedef EigenLinearAlgebraBackend::DenseVector DenseVector;
+typedef MatrixFreeLinearOperator<Calculus, 2, PRIMAL, 2, PRIMAL> MatrixFree2;
+typedef MatrixFreeLinearOperator<Calculus, 0, PRIMAL, 1, PRIMAL> MatrixFree01;
+
+/// @return the calculus of a digital disk of radius \a r.
+Calculus makeDiskCalculus( int r )
+{
+  const Z2i::Domain domain( Z2i::Point::diagonal( -r-1 ), Z2i::Point::diagonal( r+1 ) );
+  Z2i::DigitalSet set( domain );
+  for ( auto p : domain )
+    if ( p.squaredNorm() <= r*r ) set.insertNew( p );
+  return CalculusFactory::createFromDigitalSet( set );
+}
+
+/// @return a k-form with values in [0.5,1.5].
+template <typename KForm>
+KForm makeWeights( const Calculus& calculus, int seed )
+{
+  KForm w( calculus );
+  for ( typename Calculus::Index i = 0; i < w.length(); i++ )
+    w.myContainer( i ) = 1.0 + 0.5 * std::sin( 0.7 * i + seed );
+  return w;
+}
+
+SCENARIO( "MatrixFreeLinearOperator applies compositions", "[dec][matrixfree]" )
+{
+  const Calculus calculus = makeDiskCalculus( 12 );
+  const auto AD2 = calculus.antiderivative<2, PRIMAL>();
+  const auto D0  = calculus.derivative<0, PRIMAL>();
+  const auto D1  = calculus.derivative<1, PRIMAL>();
+  const auto w1  = makeWeights<Calculus::PrimalForm1>( calculus, 1 );
+  const auto w2  = makeWeights<Calculus::PrimalForm2>( calculus, 2 );
+  const auto x2  = makeWeights<Calculus::PrimalForm2>( calculus, 3 );
+
+  GIVEN( "A sum of identity, diagonal and normal compositions" ) {
+    MatrixFree2 ope( calculus );
+    ope.addIdentity( 0.5 );
+    ope.addDiagonal( w2, 2.0 );
+    const auto term = ope.addNormalComposition( AD2, w1 );
+    ope.addComposition( D1, D1.transpose(), -0.25 );
+    const Calculus::PrimalIdentity2 expected = 0.5 * calculus.identity<2, PRIMAL>()
+      + 2.0 * dec_helper::diagonal( w2 )
+      + AD2.transpose() * dec_helper::diagonal( w1 ) * AD2
+      + (-0.25) * ( D1 * D1.transpose() );
+    THEN( "It is the explicit operator" ) {
+      REQUIRE( ope.isValid() );
+      REQUIRE( ope.nbTerms() == 4 );
+      REQUIRE( ope.rows() == calculus.kFormLength( 2, PRIMAL ) );
+      const DenseVector y = ( ope * x2 ).myContainer;
+      const DenseVector e = ( expected * x2 ).myContainer;
+      REQUIRE( ( y - e ).norm() < 1e-12 * e.norm() );
+      const DenseVector eigen_y = ope * x2.myContainer;
+      REQUIRE( ( eigen_y - e ).norm() < 1e-12 * e.norm() );
+      const DenseVector eigen_2y = ope * ( 2.0 * x2.myContainer );
+      REQUIRE( ( eigen_2y - 2.0 * e ).norm() < 2e-12 * e.norm() );
+      DenseVector residual = e;
+      ope.addApply( x2.myContainer, residual, -1.0 );
+      REQUIRE( residual.norm() < 1e-12 * e.norm() );
+      REQUIRE( ( DenseVector( ope.toLinearOperator().myContainer * x2.myContainer ) - e ).norm()
+               < 1e-12 * e.norm() );
+      REQUIRE( ( ope.diagonal() - DenseVector( expected.myContainer.diagonal() ) ).norm() < 1e-12 );
+    }
+    THEN( "Weights may change without rebuilding the operator" ) {
+      ope.setWeights( term, 3.0 * w1 );
+      const Calculus::PrimalIdentity2 other = expected
+        + 2.0 * ( AD2.transpose() * dec_helper::diagonal( w1 ) * AD2 );
+      const DenseVector y = ( ope * x2 ).myContainer;
+      const DenseVector e = ( other * x2 ).myContainer;
+      REQUIRE( ( y - e ).norm() < 1e-12 * e.norm() );
+    }
+  }
+  GIVEN( "An operator between different kforms" ) {
+    MatrixFree01 ope( calculus );
+    auto M01 = D0;
+    M01.myContainer = 0.5 * M01.myContainer.cwiseAbs();
+    ope.addOperator( D0, 2.0 );
+    ope.addComposition( calculus.identity<1, PRIMAL>(), w1, M01 );
+    const auto x0 = makeWeights<Calculus::PrimalForm0>( calculus, 4 );
+    THEN( "It is the explicit operator" ) {
+      const DenseVector e = ( 2.0 * ( D0 * x0 ) + dec_helper::diagonal( w1 ) * ( M01 * x0 ) ).myContainer;
+      const DenseVector y = ( ope * x0 ).myContainer;
+      REQUIRE( y.size() == calculus.kFormLength( 1, PRIMAL ) );
+      REQUIRE( ( y - e ).norm() < 1e-12 * e.norm() );
+    }
+  }
+}
+
+SCENARIO( "MatrixFreeLinearOperator with iterative solvers", "[dec][matrixfree]" )
+{
+  typedef DiscreteExteriorCalculusSolver<Calculus, EigenLinearAlgebraBackend::SolverSimplicialLDLT,
+                                         2, PRIMAL, 2, PRIMAL> DirectSolver;
+  typedef DiscreteExteriorCalculusSolver<Calculus, MatrixFree2::SolverConjugateGradient,
+                                         2, PRIMAL, 2, PRIMAL> MatrixFreeSolver;
+  const Calculus calculus = makeDiskCalculus( 20 );
+  const auto AD2 = calculus.antiderivative<2, PRIMAL>();
+  const auto v1  = makeWeights<Calculus::PrimalForm1>( calculus, 5 );
+  const auto g2  = makeWeights<Calculus::PrimalForm2>( calculus, 6 );
+  // Ambrosio-Tortorelli like operator: alpha Id + AD2^T diag(v^2) AD2
+  const double alpha = 0.1;
+  const Calculus::PrimalIdentity2 explicit_ope = alpha * calculus.identity<2, PRIMAL>()
+    + AD2.transpose() * dec_helper::diagonal( v1 ) * AD2;
+  DirectSolver direct;
+  direct.compute( explicit_ope );
+  const Calculus::PrimalForm2 expected = direct.solve( g2 );
+
+  MatrixFree2 ope( calculus );
+  ope.addIdentity( alpha );
+  ope.addNormalComposition( AD2, v1 );
+  THEN( "Matrix-free conjugate gradient matches the direct solver" ) {
+    MatrixFreeSolver solver;
+    solver.myLinearAlgebraSolver.setTolerance( 1e-10 );
+    solver.compute( ope );
+    const Calculus::PrimalForm2 solution = solver.solve( g2 );
+    REQUIRE( solver.isValid() );
+    REQUIRE( solver.myLinearAlgebraSolver.iterations() < ope.rows() );
+    REQUIRE( ( solution.myContainer - expected.myContainer ).norm()
+             < 1e-8 * expected.myContainer.norm() );
+  }
+  THEN( "Matrix-free BiCGSTAB matches the direct solver" ) {
+    MatrixFree2::SolverBiCGSTAB solver;
+    solver.setTolerance( 1e-10 );
+    solver.compute( ope );
+    const DenseVector solution = solver.solve( g2.myContainer );
+    REQUIRE( solver.info() == Eigen::Success );
+    REQUIRE( ( solution - expected.myContainer ).norm()
+             < 1e-8 * expected.myContainer.norm() );
+  }
+}
+
+SCENARIO( "ATSolver2D with matrix-free solvers", "[dec][matrixfree][at]" )
+{
+  typedef Shortcuts<Z3i::KSpace>         SH3;
+  typedef ShortcutsGeometry<Z3i::KSpace> SHG3;
+  auto params  = SH3::defaultParameters() | SHG3::defaultParameters();
+  params( "polynomial", "goursat" )( "gridstep", 1.0 )( "verbose", 0 );
+  auto shape   = SH3::makeImplicitShape3D( params );
+  auto K       = SH3::getKSpace( params );
+  auto dshape  = SH3::makeDigitizedImplicitShape3D( shape, params );
+  auto bimage  = SH3::makeBinaryImage( dshape, params );
+  auto surface = SH3::makeLightDigitalSurface( bimage, K, params );
+  auto surfels = SH3::getSurfelRange( surface, params );
+  auto linels  = SH3::getCellRange( surface, 1 );
+  auto normals = SHG3::getIINormalVectors( bimage, surfels, params );
+  const auto calculus = CalculusFactory::createFromNSCells<2>( surfels.begin(), surfels.end() );
+  std::vector< SH3::RealVectors > at_normals( 2, normals );
+  std::vector< SH3::Scalars >     features( 2, SH3::Scalars( linels.size() ) );
+  for ( int matrix_free = 0; matrix_free < 2; matrix_free++ )
+    {
+      ATSolver2D< Z3i::KSpace > at_solver( calculus );
+      at_solver.matrix_free = ( matrix_free == 1 );
+      at_solver.initInputVectorFieldU2( normals, surfels.cbegin(), surfels.cend() );
+      at_solver.setUp( 0.1, 0.01 );
+      at_solver.solveGammaConvergence( 2.0, 0.5, 2.0 );
+      at_solver.getOutputVectorFieldU2( at_normals[ matrix_free ], surfels.cbegin(), surfels.cend() );
+      at_solver.getOutputScalarFieldV0( features[ matrix_free ], linels.cbegin(), linels.cend() );
+    }
+  THEN( "Matrix-free and direct solvers give the same solution" ) {
+    double max_diff = 0.0;
+    for ( std::size_t i = 0; i < surfels.size(); i++ )
+      max_diff = std::max( max_diff, ( at_normals[ 0 ][ i ] - at_normals[ 1 ][ i ] ).norm() );
+    for ( std::size_t i = 0; i < linels.size(); i++ )
+      max_diff = std::max( max_diff, std::abs( features[ 0 ][ i ] - features[ 1 ][ i ] ) );
+    REQUIRE( max_diff < 1e-5 );
+  }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
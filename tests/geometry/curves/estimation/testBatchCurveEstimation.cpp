@@ -0,0 +1,258 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testBatchCurveEstimation.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing classes ContourBatch and BatchCurveEstimation.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "ConfigTest.h"
+#include "DGtalCatch.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/shapes/GaussDigitizer.h"
+#include "DGtal/shapes/parametric/Flower2D.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+#include "DGtal/io/readers/PointListReader.h"
+#include "DGtal/geometry/curves/GridCurve.h"
+#include "DGtal/geometry/curves/ArithmeticalDSSComputer.h"
+#include "DGtal/geometry/curves/StabbingCircleComputer.h"
+#include "DGtal/geometry/curves/GreedySegmentation.h"
+#include "DGtal/geometry/curves/SaturatedSegmentation.h"
+#include "DGtal/geometry/curves/estimation/SegmentComputerEstimators.h"
+#include "DGtal/geometry/curves/estimation/BatchCurveEstimation.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace Z2i;
+
+typedef ContourBatch<Point> Batch;
+
+/// Appends the boundaries of a few digitized flowers and an open
+/// curve read from a file to @a batch.
+void buildBatch( Batch & batch )
+{
+  typedef Flower2D<Space> Flower;
+  typedef GaussDigitizer<Space, Flower> Digitizer;
+  for ( unsigned int k = 0; k < 6; ++k )
+    {
+      Flower flower( 0.0, 0.0, 8.0 + 3.0 * k, 2.0 + 0.5 * k, 3 + k % 3, 0.3 * k );
+      Digitizer dig;
+      dig.attach( flower );
+      dig.init( flower.getLowerBound() - RealPoint::diagonal( 1.0 ),
+                flower.getUpperBound() + RealPoint::diagonal( 1.0 ), 1.0 );
+      KSpace K;
+      K.init( dig.getLowerBound(), dig.getUpperBound(), true );
+      SurfelAdjacency<2> SAdj( true );
+      SCell bel = Surfaces<KSpace>::findABel( K, dig, 10000 );
+      std::vector<Point> points;
+      Surfaces<KSpace>::track2DBoundaryPoints( points, K, SAdj, dig, bel );
+      batch.addContour( points.begin(), points.end() );
+    }
+  // an empty contour must be skipped.
+  std::vector<Point> empty;
+  batch.addContour( empty.begin(), empty.end() );
+  fstream inputStream( ( testPath + "samples/sinus2D4.dat" ).c_str(), ios::in );
+  std::vector<Point> sinus = PointListReader<Point>::getPointsFromInputStream( inputStream );
+  batch.addContour( sinus.begin(), sinus.end() );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing classes ContourBatch and BatchCurveEstimation.
+///////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE( "Testing ContourBatch" )
+{
+  Batch batch;
+  buildBatch( batch );
+  REQUIRE( batch.isValid() );
+  REQUIRE( batch.nbContours() == 8 );
+  REQUIRE( batch.size( 6 ) == 0 );
+  Batch::Size total = 0;
+  for ( Batch::Size c = 0; c < batch.nbContours(); ++c )
+    {
+      REQUIRE( batch.offset( c ) == total );
+      REQUIRE( (Batch::Size) std::distance( batch.begin( c ), batch.end( c ) ) == batch.size( c ) );
+      total += batch.size( c );
+    }
+  REQUIRE( total == batch.nbPoints() );
+  REQUIRE( *batch.circulator( 1 ) == batch.point( 1, 0 ) );
+  REQUIRE( *( --batch.circulator( 1 ) ) == batch.point( 1, batch.size( 1 ) - 1 ) );
+}
+
+TEST_CASE( "Testing BatchCurveEstimation" )
+{
+  Batch batch;
+  buildBatch( batch );
+
+  SECTION("Greedy segmentation of open contours")
+    {
+      typedef ArithmeticalDSSComputer<Batch::ConstIterator, int, 4> SegmentComputer;
+      typedef GreedySegmentation<SegmentComputer> Segmentation;
+      std::vector<BatchCurveEstimation::Size> offsets;
+      std::vector<BatchCurveEstimation::Segment> segments;
+      BatchCurveEstimation::segmentation<Segmentation>( batch, SegmentComputer(),
+                                                        offsets, segments );
+      REQUIRE( offsets.size() == batch.nbContours() + 1 );
+      REQUIRE( offsets.back() == segments.size() );
+      unsigned int nbok = 0, nb = 0;
+      for ( Batch::Size c = 0; c < batch.nbContours(); ++c )
+        {
+          if ( batch.size( c ) == 0 ) continue;
+          Segmentation s( batch.begin( c ), batch.end( c ), SegmentComputer() );
+          BatchCurveEstimation::Size j = offsets[ c ];
+          for ( Segmentation::SegmentComputerIterator it = s.begin(), itEnd = s.end();
+                it != itEnd; ++it, ++j, ++nb )
+            nbok += ( j < offsets[ c + 1 ]
+                      && segments[ j ].first == (Batch::Size)( it->begin() - batch.points().begin() )
+                      && segments[ j ].size == (Batch::Size)( it->end() - it->begin() ) ) ? 1 : 0;
+          REQUIRE( j == offsets[ c + 1 ] );
+        }
+      REQUIRE( nb > 0 );
+      REQUIRE( nbok == nb );
+    }
+
+  SECTION("Saturated segmentation of closed contours")
+    {
+      typedef ArithmeticalDSSComputer<Batch::ConstCirculator, int, 4> SegmentComputer;
+      typedef SaturatedSegmentation<SegmentComputer> Segmentation;
+      std::vector<BatchCurveEstimation::Size> offsets;
+      std::vector<BatchCurveEstimation::Segment> segments;
+      BatchCurveEstimation::segmentation<Segmentation>( batch, SegmentComputer(),
+                                                        offsets, segments );
+      unsigned int nbok = 0, nb = 0;
+      for ( Batch::Size c = 0; c < 6; ++c )
+        {
+          Segmentation s( batch.circulator( c ), batch.circulator( c ), SegmentComputer() );
+          BatchCurveEstimation::Size j = offsets[ c ];
+          for ( Segmentation::SegmentComputerIterator it = s.begin(), itEnd = s.end();
+                it != itEnd; ++it, ++j, ++nb )
+            nbok += ( segments[ j ].first == (Batch::Size)( it->begin().base() - batch.points().begin() ) ) ? 1 : 0;
+          REQUIRE( j == offsets[ c + 1 ] );
+          // maximal segments of a closed curve cover it several times
+          // and every segment stays within its contour.
+          for ( j = offsets[ c ]; j < offsets[ c + 1 ]; ++j )
+            {
+              REQUIRE( segments[ j ].first >= batch.offset( c ) );
+              REQUIRE( segments[ j ].first < batch.offset( c ) + batch.size( c ) );
+              REQUIRE( segments[ j ].size <= batch.size( c ) );
+            }
+        }
+      REQUIRE( nbok == nb );
+    }
+
+  SECTION("Most centered tangent estimation on closed contours")
+    {
+      typedef ArithmeticalDSSComputer<Batch::ConstCirculator, int, 4> SegmentComputer;
+      typedef TangentAngleFromDSSEstimator<SegmentComputer> SCEstimator;
+      typedef MostCenteredMaximalSegmentEstimator<SegmentComputer, SCEstimator> Estimator;
+      std::vector<double> angles, angles1;
+      BatchCurveEstimation::mostCentered( batch, 1.0, SegmentComputer(), SCEstimator(), angles );
+      BatchCurveEstimation::mostCentered( batch, 1.0, SegmentComputer(), SCEstimator(), angles1, false );
+      REQUIRE( angles.size() == batch.nbPoints() );
+      REQUIRE( angles == angles1 );
+      unsigned int nbok = 0, nb = 0;
+      for ( Batch::Size c = 0; c < batch.nbContours(); ++c )
+        {
+          if ( batch.size( c ) == 0 ) continue;
+          SegmentComputer sc;
+          SCEstimator sce;
+          Estimator e( sc, sce );
+          e.init( 1.0, batch.circulator( c ), batch.circulator( c ) );
+          std::vector<double> expected;
+          e.eval( batch.circulator( c ), batch.circulator( c ), std::back_inserter( expected ) );
+          REQUIRE( expected.size() == batch.size( c ) );
+          for ( Batch::Size i = 0; i < expected.size(); ++i, ++nb )
+            nbok += ( angles[ batch.offset( c ) + i ] == expected[ i ] ) ? 1 : 0;
+        }
+      REQUIRE( nbok == nb );
+    }
+
+  SECTION("Most centered curvature estimation on contours of incident points")
+    {
+      // contours of pairs of inner/outer points, as given by GridCurve.
+      typedef std::pair<Point, Point> Pair;
+      typedef ContourBatch<Pair> PairBatch;
+      typedef StabbingCircleComputer<PairBatch::ConstCirculator> SegmentComputer;
+      typedef CurvatureFromDCAEstimator<SegmentComputer> SCEstimator;
+      typedef MostCenteredMaximalSegmentEstimator<SegmentComputer, SCEstimator> Estimator;
+      PairBatch pairs;
+      for ( Batch::Size c = 0; c < 6; ++c )
+        {
+          GridCurve<KSpace> gridcurve;
+          std::vector<Point> points( batch.begin( c ), batch.end( c ) );
+          gridcurve.initFromVector( points );
+          GridCurve<KSpace>::IncidentPointsRange r = gridcurve.getIncidentPointsRange();
+          pairs.addContour( r.begin(), r.end() );
+        }
+      std::vector<double> curvatures;
+      BatchCurveEstimation::mostCentered( pairs, 0.5, SegmentComputer(), SCEstimator(), curvatures );
+      REQUIRE( curvatures.size() == pairs.nbPoints() );
+      unsigned int nbok = 0, nb = 0;
+      for ( PairBatch::Size c = 0; c < pairs.nbContours(); ++c )
+        {
+          SegmentComputer sc;
+          SCEstimator sce;
+          Estimator e( sc, sce );
+          e.init( 0.5, pairs.circulator( c ), pairs.circulator( c ) );
+          std::vector<double> expected;
+          e.eval( pairs.circulator( c ), pairs.circulator( c ), std::back_inserter( expected ) );
+          for ( PairBatch::Size i = 0; i < expected.size(); ++i, ++nb )
+            nbok += ( curvatures[ pairs.offset( c ) + i ] == expected[ i ] ) ? 1 : 0;
+        }
+      REQUIRE( nb == pairs.nbPoints() );
+      REQUIRE( nbok == nb );
+    }
+
+  SECTION("Lambda MST tangent estimation")
+    {
+      typedef ArithmeticalDSSComputer<Batch::ConstIterator, int, 4> SegmentComputer;
+      typedef SaturatedSegmentation<SegmentComputer> Segmentation;
+      std::vector<RealVector> tangents;
+      BatchCurveEstimation::lambdaMST<Segmentation>( batch, SegmentComputer(), tangents );
+      REQUIRE( tangents.size() == batch.nbPoints() );
+      unsigned int nbok = 0, nb = 0;
+      for ( Batch::Size c = 0; c < batch.nbContours(); ++c )
+        {
+          if ( batch.size( c ) == 0 ) continue;
+          Segmentation s( batch.begin( c ), batch.end( c ), SegmentComputer() );
+          LambdaMST2D<Segmentation> lmst;
+          lmst.attach( s );
+          lmst.init( batch.begin( c ), batch.end( c ) );
+          std::vector<RealVector> expected;
+          lmst.eval( batch.begin( c ), batch.end( c ), std::back_inserter( expected ) );
+          for ( Batch::Size i = 0; i < expected.size(); ++i, ++nb )
+            nbok += ( tangents[ batch.offset( c ) + i ] == expected[ i ] ) ? 1 : 0;
+        }
+      REQUIRE( nb == batch.nbPoints() );
+      REQUIRE( nbok == nb );
+    }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -89,6 +89,18 @@ public:
     lmst64.eval < back_insert_iterator< vector < RealVector > > > ( curve.begin(), curve.end(),  back_inserter ( tangent ) );
     return true;
   }
+  bool lambda64Chunks()
+  {
+    Segmentation segmenter ( curve.begin(), curve.end(), SegmentComputer() );
+    LambdaMST2D < Segmentation > lmst64;
+    lmst64.attach ( segmenter );
+    lmst64.init ( curve.begin(), curve.end() );
+    std::vector < RealVector > tangent, tangentChunks;
+    lmst64.eval ( curve.begin(), curve.end(),  back_inserter ( tangent ) );
+    segmenter.computeMaximalSegments ( 0 );
+    lmst64.eval ( curve.begin(), curve.end(),  back_inserter ( tangentChunks ) );
+    return ( ! segmenter.maximalSegments().empty() ) && ( tangent == tangentChunks );
+  }
 };
 
 
@@ -106,6 +118,9 @@ int main( int , char**  )
         trace.beginBlock ( "Testing calculation for whole curve" );
            res &= testLMST.lambda64();
         trace.endBlock();
+        trace.beginBlock ( "Testing calculation with maximal segments computed by chunks" );
+           res &= testLMST.lambda64Chunks();
+        trace.endBlock();
     trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
     trace.endBlock();
     return res ? 0 : 1;
@@ -111,6 +111,68 @@ public:
       return true;
   }
 
+  bool lambda64RangeByPoint()
+  {
+      Segmentation segmenter ( curve.begin(), curve.end(), SegmentComputer() );
+      LambdaMST3D < Segmentation > lmst64;
+      lmst64.attach ( segmenter );
+      lmst64.init ( curve.begin(), curve.end() );
+      vector < RealVector > tangent;
+      lmst64.eval ( curve.begin(), curve.end(), back_inserter ( tangent ) );
+      // both ways give the same tangents, up to their orientation
+      unsigned int nbok = 0;
+      for ( unsigned int i = 0; i < curve.size(); ++i )
+      {
+        RealVector t = lmst64.eval ( curve[ i ] );
+        nbok += ( std::min ( ( t - tangent[ i ] ).norm(), ( t + tangent[ i ] ).norm() ) < 1e-9 ) ? 1 : 0;
+      }
+      return tangent.size() == curve.size() && nbok == curve.size();
+  }
+
+  bool lambda64Reference()
+  {
+      // tangents computed on samples/sinus3D.dat by the former
+      // implementation, which accumulated partial tangents in a std::multimap.
+      const double full[ 11 ][ 3 ] = {
+        { 1, 0, 0 },
+        { 0.6247354673886103, -0.37526453261138965, 0 },
+        { 0.49999999999999967, -0.50000000000000033, 0 },
+        { 0.49999999999999967, 0.50000000000000033, 0 },
+        { 0.50000000000000033, 0.49999999999999967, 0 },
+        { 0.37526453261138998, 0, -0.62473546738861008 },
+        { 0.62473546738861008, -0.37526453261138998, 0 },
+        { 0.49999999999999967, 0, -0.50000000000000033 },
+        { 0, 0.49999999999999967, 0.50000000000000033 },
+        { 0.49999999999999967, 0, 0.50000000000000033 },
+        { 0, 0, 1 } };
+      // same for the subrange [20,70) of the curve.
+      const double sub[ 8 ][ 3 ] = {
+        { 0.49999999999999967, -0.50000000000000033, 0 },
+        { 1, 0, 0 },
+        { 0.50000000000000033, 0.49999999999999967, 0 },
+        { 0.62473546738861008, 0.37526453261138998, 0 },
+        { 1, 0, 0 },
+        { 0, -1, 0 },
+        { 0.6247354673886103, -0.37526453261138965, 0 },
+        { 0, -1, 0 } };
+      Segmentation segmenter ( curve.begin(), curve.end(), SegmentComputer() );
+      LambdaMST3D < Segmentation > lmst64;
+      lmst64.attach ( segmenter );
+      lmst64.init ( curve.begin(), curve.end() );
+      vector < RealVector > tangent, subTangent;
+      lmst64.eval ( curve.begin(), curve.end(), back_inserter ( tangent ) );
+      lmst64.eval ( curve.begin() + 20, curve.begin() + 70, back_inserter ( subTangent ) );
+      if ( curve.size() != 101 || subTangent.size() != 50 )
+        return false;
+      unsigned int nbok = 0;
+      for ( unsigned int i = 0; i < 11; ++i )
+        nbok += ( ( tangent[ 10 * i ] - RealVector ( full[ i ][ 0 ], full[ i ][ 1 ], full[ i ][ 2 ] ) ).norm() < 1e-12 ) ? 1 : 0;
+      for ( unsigned int i = 0; i < 8; ++i )
+        nbok += ( ( subTangent[ 7 * i ] - RealVector ( sub[ i ][ 0 ], sub[ i ][ 1 ], sub[ i ][ 2 ] ) ).norm() < 1e-12 ) ? 1 : 0;
+      trace.info() << "(" << nbok << "/19) reference tangents" << endl;
+      return nbok == 19;
+  }
+
   bool lambdaSinByPoint ()
   {
      Segmentation segmenter ( curve.begin(), curve.end(), SegmentComputer() );
@@ -173,6 +235,8 @@ int main( int , char**  )
         trace.endBlock();
         trace.beginBlock ( "Testing calculation for whole curve" );
            res &= testLMST.lambda64();
+           res &= testLMST.lambda64RangeByPoint();
+           res &= testLMST.lambda64Reference();
            res &= testLMST.lambdaSin();
            res &= testLMST.lambdaExp();
         trace.endBlock();
@@ -47,6 +47,7 @@
 #include "DGtal/topology/KhalimskySpaceND.h"
 
 #include "DGtal/geometry/curves/GridCurve.h"
+#include "DGtal/geometry/curves/FreemanChain.h"
 #include "DGtal/geometry/curves/ArithmeticalDSSComputer.h"
 #include "DGtal/geometry/curves/estimation/MostCenteredMaximalSegmentEstimator.h"
 #include "DGtal/geometry/curves/estimation/CCurveLocalGeometricEstimator.h"
@@ -119,6 +120,19 @@ bool test(const I& itb, const I& ite)
 
   trace.info() << "(" << nbok << "/" << nb << ")" << std::endl; 
 
+  {
+    trace.info() << "Eval with maximal segments computed by chunks " << endl;
+    std::vector<Value> v4; 
+    Estimator e2(sc,f); 
+    e2.init(1,itb,ite);
+    e2.setNbChunks(0);
+    e2.eval(itb, ite, std::back_inserter(v4));
+    nbok += ( ( v4.size() == v2.size() ) &&
+	      ( std::equal(v4.begin(), v4.end(), v2.begin() ) ) )?1:0; 
+    nb++; 
+    trace.info() << "(" << nbok << "/" << nb << ")" << std::endl; 
+  }
+
   if ( (ite-itb) >= 10) 
     {
 
@@ -169,6 +183,28 @@ bool testEval(string filename)
 
 }
 
+/**
+ * Applying test on a Freeman chain
+ *
+ */
+bool testEvalFreemanChain(string filename)
+{
+  trace.info() << endl;
+  trace.info() << "Reading FreemanChain from " << filename << endl;
+  
+  typedef FreemanChain<int> FC; 
+  typedef FC::Point Point; 
+  ifstream instream; // input stream
+  instream.open (filename.c_str(), ifstream::in);
+  FC fc(instream); 
+  std::vector<Point> points; 
+  points.assign( fc.begin(), fc.end() ); 
+  points.pop_back(); //the first point is repeated
+  typedef std::vector<Point>::const_iterator ConstIterator; 
+  Circulator<ConstIterator> c( points.begin(), points.begin(), points.end() ); 
+  return test(c, c); 
+}
+
 /////////////////////////////////////////////////////////////////////////
 //////////////// MAIN ///////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////
@@ -189,6 +225,7 @@ int main(int argc, char **argv)
   bool res = testEval(sinus2D4)
     && testEval(square)
     && testEval(dss)
+    && testEvalFreemanChain(testPath + "samples/klokanNoise0_75_125_175.fc")
     //other tests
     ;
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
@@ -0,0 +1,110 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testBinomialConvolver-benchmark.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/19
+ *
+ * Benchmarks the binomial convolution of long contours: direct
+ * convolution by G2n (Signal::operator*) versus iterated G2 passes
+ * (Signal::convolveG2n, used by BinomialConvolver). The number of
+ * contour points (default 10^6) and the mask order n (default 100)
+ * may be given as arguments.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/PointVector.h"
+#include "DGtal/math/Signal.h"
+#include "DGtal/geometry/curves/BinomialConvolver.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+
+int main( int argc, char** argv )
+{
+  const unsigned int nb = ( argc > 1 ) ? atoi( argv[ 1 ] ) : 1000000;
+  const unsigned int n  = ( argc > 2 ) ? atoi( argv[ 2 ] ) : 100;
+  trace.beginBlock ( "Benchmarking binomial convolution" );
+  trace.info() << nb << " contour points, mask G2n with n=" << n << std::endl;
+
+  // A closed contour: a circle with a small perturbation.
+  typedef PointVector<2, double> RealPoint;
+  std::vector< RealPoint > points( nb );
+  const double r = nb / ( 2.0 * M_PI );
+  for ( unsigned int i = 0; i < nb; ++i )
+    {
+      const double t = 2.0 * M_PI * i / nb;
+      const double rt = r + 2.0 * cos( 50.0 * t );
+      points[ i ] = RealPoint( std::round( rt * cos( t ) ), std::round( rt * sin( t ) ) );
+    }
+  std::vector< double > xs( nb );
+  for ( unsigned int i = 0; i < nb; ++i ) xs[ i ] = points[ i ][ 0 ];
+
+  bool res = true;
+  for ( int periodic = 1; periodic >= 0; --periodic )
+    {
+      trace.beginBlock( periodic ? "Closed contour" : "Open contour" );
+      Signal<double> x( xs.data(), nb, 0, periodic == 1, 0.0 );
+      Clock c;
+      c.startClock();
+      Signal<double> direct = x * Signal<double>::G2n( n );
+      const double t_direct = c.stopClock();
+      c.startClock();
+      Signal<double> passes = x.convolveG2n( n );
+      const double t_passes = c.stopClock();
+      double error = 0.0;
+      for ( int i = 0; i < (int) nb; ++i )
+        error = std::max( error, std::fabs( direct[ i ] - passes[ i ] ) );
+      trace.info() << "direct convolution: " << t_direct << " ms" << std::endl;
+      trace.info() << "iterated G2 passes: " << t_passes << " ms" << std::endl;
+      trace.info() << "max difference    : " << error << std::endl;
+      res = res && ( error < 1e-6 );
+      trace.endBlock();
+    }
+
+  trace.beginBlock( "BinomialConvolver (closed contour)" );
+  typedef std::vector< RealPoint >::const_iterator ConstIteratorOnPoints;
+  BinomialConvolver<ConstIteratorOnPoints, double> bcc( n );
+  Clock c;
+  c.startClock();
+  bcc.init( 1.0, points.begin(), points.end(), true );
+  trace.info() << "init: " << c.stopClock() << " ms" << std::endl;
+  c.startClock();
+  double total = 0.0;
+  for ( unsigned int i = 0; i < nb; ++i ) total += bcc.curvature( i );
+  trace.info() << "curvatures: " << c.stopClock() << " ms"
+               << " (mean=" << total / nb << ")" << std::endl;
+  trace.endBlock();
+
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,172 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testPackedFreemanChain.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing class PackedFreemanChain.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "ConfigTest.h"
+#include "DGtalCatch.h"
+#include "DGtal/geometry/curves/FreemanChain.h"
+#include "DGtal/geometry/curves/PackedFreemanChain.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef FreemanChain<int> FC;
+typedef PackedFreemanChain<int> PFC;
+
+/// Twice the signed area of the polygon of the points of a chain.
+int twiceSignedArea( const std::vector<PFC::Point> & points )
+{
+  int area = 0;
+  for ( std::size_t i = 0; i + 1 < points.size(); ++i )
+    area += points[ i ][ 0 ] * points[ i + 1 ][ 1 ] - points[ i + 1 ][ 0 ] * points[ i ][ 1 ];
+  area += points.back()[ 0 ] * points.front()[ 1 ] - points.front()[ 0 ] * points.back()[ 1 ];
+  return area;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class PackedFreemanChain.
+///////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE( "Testing PackedFreemanChain" )
+{
+  std::vector<FC> chains;
+  chains.push_back( FC( "00112233", 0, 0 ) );
+  chains.push_back( FC( "", -3, 5 ) );
+  chains.push_back( FC( "00001030003222321222", -42, 12 ) );
+  chains.push_back( FC( "0101010122", 7, -9 ) );
+  const std::string files[] = { "samples/contourS.fc", "samples/klokanNoise0_75_125_175.fc",
+                                "samples/BigBall2.fc" };
+  for ( unsigned int i = 0; i < 3; ++i )
+    {
+      std::fstream fst( ( testPath + files[ i ] ).c_str(), std::ios::in );
+      chains.push_back( FC( fst ) );
+    }
+
+  SECTION("Codes, points and extremities")
+    {
+      for ( std::size_t i = 0; i < chains.size(); ++i )
+        {
+          const FC & fc = chains[ i ];
+          PFC pfc( fc );
+          REQUIRE( pfc.isValid() );
+          REQUIRE( pfc.size() == fc.size() );
+          REQUIRE( pfc.firstPoint() == fc.firstPoint() );
+          REQUIRE( pfc.lastPoint() == fc.lastPoint() );
+          REQUIRE( pfc.isClosed() == ( fc.isClosed() != 0 ) );
+          REQUIRE( pfc.toFreemanChain() == fc );
+          // FreemanChain iterates over no point at all when empty.
+          std::vector<PFC::Point> expected( fc.begin(), fc.end() );
+          if ( fc.size() == 0 ) expected.push_back( fc.firstPoint() );
+          std::vector<PFC::Point> points;
+          pfc.getPoints( points );
+          REQUIRE( points == expected );
+          unsigned int nbok = 0;
+          for ( std::size_t k = 0; k < fc.size(); ++k )
+            nbok += ( pfc.code( k ) == (unsigned int)( fc.code( k ) - '0' ) ) ? 1 : 0;
+          REQUIRE( nbok == fc.size() );
+        }
+    }
+
+  SECTION("Bounding box and area")
+    {
+      for ( std::size_t i = 0; i < chains.size(); ++i )
+        {
+          const FC & fc = chains[ i ];
+          PFC pfc( fc );
+          int min_x, min_y, max_x, max_y;
+          int pmin_x, pmin_y, pmax_x, pmax_y;
+          fc.computeBoundingBox( min_x, min_y, max_x, max_y );
+          pfc.computeBoundingBox( pmin_x, pmin_y, pmax_x, pmax_y );
+          REQUIRE( pmin_x == min_x );
+          REQUIRE( pmin_y == min_y );
+          REQUIRE( pmax_x == max_x );
+          REQUIRE( pmax_y == max_y );
+          std::vector<PFC::Point> points;
+          pfc.getPoints( points );
+          REQUIRE( pfc.twiceSignedArea() == twiceSignedArea( points ) );
+        }
+      REQUIRE( PFC( chains[ 0 ] ).twiceSignedArea() == 8 );
+    }
+
+  SECTION("Appending codes")
+    {
+      PFC pfc( 2, 3 );
+      FC fc( "", 2, 3 );
+      for ( unsigned int k = 0; k < 100; ++k )
+        {
+          const unsigned int c = ( k * 7 + k / 5 ) % 4;
+          pfc.push_back( c );
+          fc.extend( (char)( '0' + c ) );
+          REQUIRE( pfc.lastPoint() == fc.lastPoint() );
+        }
+      REQUIRE( pfc.toFreemanChain() == fc );
+    }
+
+  SECTION("Binary I/O")
+    {
+      std::vector<PFC> packed;
+      for ( std::size_t i = 0; i < chains.size(); ++i )
+        packed.push_back( PFC( chains[ i ] ) );
+      std::stringstream ss;
+      PFC::write( ss, packed );
+      std::vector<PFC> read;
+      PFC::read( ss, read );
+      REQUIRE( read.size() == packed.size() );
+      for ( std::size_t i = 0; i < chains.size(); ++i )
+        {
+          REQUIRE( read[ i ].lastPoint() == chains[ i ].lastPoint() );
+          REQUIRE( read[ i ].words() == packed[ i ].words() );
+          REQUIRE( read[ i ].toFreemanChain() == chains[ i ] );
+        }
+      std::stringstream bad( "PFC2" );
+      REQUIRE_THROWS_AS( PFC::read( bad, read ), IOException );
+      std::string truncated = ss.str().substr( 0, ss.str().size() / 2 );
+      std::stringstream tss( truncated );
+      REQUIRE_THROWS_AS( PFC::read( tss, read ), IOException );
+      // a chain whose size field is corrupted runs out of data.
+      std::string corrupted = ss.str();
+      corrupted[ 4 + 8 + 16 + 7 ] = (char) 0x7F;
+      std::stringstream css( corrupted );
+      REQUIRE_THROWS_AS( PFC::read( css, read ), IOException );
+      // a size whose word count overflows is rejected before decoding.
+      std::string overflow = ss.str();
+      for ( unsigned int b = 0; b < 8; ++b )
+        overflow[ 4 + 8 + 16 + b ] = (char) 0xFF;
+      std::stringstream oss( overflow );
+      REQUIRE_THROWS_AS( PFC::read( oss, read ), IOException );
+    }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
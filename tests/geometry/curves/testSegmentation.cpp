@@ -935,6 +935,107 @@ bool SaturatedSegmentationTest()
   return (compteur == 4295);
 }
 
+/**
+ * Compares the segments retrieved by a segmentation with and
+ * without precomputed maximal segments
+ */
+template <typename Segmentation>
+bool sameSegments(Segmentation& seq, Segmentation& chunked)
+{
+  typename Segmentation::SegmentComputerIterator i = seq.begin();
+  typename Segmentation::SegmentComputerIterator iend = seq.end();
+  typename Segmentation::SegmentComputerIterator j = chunked.begin();
+  typename Segmentation::SegmentComputerIterator jend = chunked.end();
+  for ( ; (i != iend) && (j != jend); ++i, ++j) {
+    if ( (i->begin() != j->begin()) || (i->end() != j->end())
+         || (i.intersectNext() != j.intersectNext())
+         || (i.intersectPrevious() != j.intersectPrevious()) )
+      return false;
+  }
+  return (i == iend) && (j == jend);
+}
+
+/**
+ * Maximal segments computed by chunks
+ */
+bool SaturatedSegmentationChunksTest()
+{
+  typedef int Coordinate;
+  typedef FreemanChain<Coordinate> FC; 
+  typedef PointVector<2,Coordinate> Point; 
+  typedef vector<Point>::const_iterator ConstIterator; 
+  typedef Circulator<ConstIterator> ConstCirculator; 
+
+  trace.beginBlock("saturated Segmentation computed by chunks");
+
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  const std::string files[] = { "samples/BigBall2.fc", "samples/klokanNoise0_75_125_175.fc" };
+  const unsigned int chunks[] = { 0, 1, 2, 3, 7, 64 };
+  const std::string modes[] = { "First", "MostCentered", "Last", "First++", "MostCentered++", "Last++" };
+  for (unsigned int f = 0; f < 2; ++f) {
+    std::fstream fst;
+    fst.open ( (testPath + files[f]).c_str(), std::ios::in);
+    FC fc(fst);
+    vector<Point> vPts; 
+    vPts.assign(fc.begin(),fc.end()); 
+    vPts.pop_back(); //the first point is repeated
+    trace.info() << files[f] << " " << vPts.size() << " points" << endl;
+
+    { //closed curve
+      typedef ArithmeticalDSSComputer<ConstCirculator,Coordinate,4> RecognitionAlgorithm;
+      typedef SaturatedSegmentation<RecognitionAlgorithm> Segmentation;
+      ConstCirculator c(vPts.begin(), vPts.begin(), vPts.end() ); 
+      for (unsigned int k = 0; k < 6; ++k) {
+        Segmentation seq(c,c,RecognitionAlgorithm());
+        Segmentation chunked(c,c,RecognitionAlgorithm());
+        chunked.computeMaximalSegments( chunks[k] );
+        //whole range, number of maximal segments
+        seq.setMode("First");
+        chunked.setMode("First");
+        unsigned int n = 0; 
+        for (Segmentation::SegmentComputerIterator i = seq.begin(); i != seq.end(); ++i) ++n;
+        nbok += ( n == chunked.maximalSegments().size() ) ? 1 : 0; 
+        nb++;
+        for (unsigned int m = 0; m < 6; ++m) {
+          seq.setSubRange(c,c); seq.setMode(modes[m]);
+          chunked.setSubRange(c,c); chunked.setMode(modes[m]);
+          nbok += sameSegments(seq, chunked) ? 1 : 0; 
+          nb++;
+          seq.setSubRange(c+100,c+700); seq.setMode(modes[m]);
+          chunked.setSubRange(c+100,c+700); chunked.setMode(modes[m]);
+          nbok += sameSegments(seq, chunked) ? 1 : 0; 
+          nb++;
+        }
+      }
+    }
+
+    { //open curve
+      typedef ArithmeticalDSSComputer<ConstIterator,Coordinate,4> RecognitionAlgorithm;
+      typedef SaturatedSegmentation<RecognitionAlgorithm> Segmentation;
+      for (unsigned int k = 0; k < 6; ++k) {
+        Segmentation seq(vPts.begin(),vPts.end(),RecognitionAlgorithm());
+        Segmentation chunked(vPts.begin(),vPts.end(),RecognitionAlgorithm());
+        chunked.computeMaximalSegments( chunks[k] );
+        for (unsigned int m = 0; m < 6; ++m) {
+          seq.setSubRange(vPts.begin(),vPts.end()); seq.setMode(modes[m]);
+          chunked.setSubRange(vPts.begin(),vPts.end()); chunked.setMode(modes[m]);
+          nbok += sameSegments(seq, chunked) ? 1 : 0; 
+          nb++;
+          seq.setSubRange(vPts.begin()+100,vPts.begin()+700); seq.setMode(modes[m]);
+          chunked.setSubRange(vPts.begin()+100,vPts.begin()+700); chunked.setMode(modes[m]);
+          nbok += sameSegments(seq, chunked) ? 1 : 0; 
+          nb++;
+        }
+      }
+    }
+  }
+  trace.info() << "(" << nbok << "/" << nb << ")" << endl;
+  trace.endBlock();
+
+  return (nbok == nb);
+}
+
 /////////////////////////////////////////////////////////////////////////
 //////////////// MAIN ///////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////
@@ -951,6 +1052,7 @@ int main(int argc, char **argv)
   bool res = greedySegmentationVisualTest()
 && SaturatedSegmentationVisualTest()
 && SaturatedSegmentationTest()
+&& SaturatedSegmentationChunksTest()
 ;
 
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
@@ -34,8 +34,11 @@
 
 #include "DGtal/kernel/PointVector.h"
 #include "DGtal/geometry/tools/Hull2DHelpers.h"
+#include "DGtal/geometry/tools/DynamicConvexHull2D.h"
 #include "DGtal/geometry/tools/PolarPointComparatorBy2x2DetComputer.h"
 #include "DGtal/geometry/tools/determinant/InHalfPlaneBySimple3x3Matrix.h"
+#include "DGtal/geometry/tools/determinant/InHalfPlaneBy2x2DetComputer.h"
+#include "DGtal/geometry/tools/determinant/AvnaimEtAl2x2DetSignComputer.h"
 #include "DGtal/geometry/tools/determinant/PredicateFromOrientationFunctor2.h"
 #include "DGtal/io/boards/Board2D.h"
 ///////////////////////////////////////////////////////////////////////////////
@@ -267,6 +270,83 @@ bool testConvexHull2D()
 }
 
 
+/**
+ * Testing the convex hull of points inserted in any order and the
+ * parallel convex hull algorithm against Andrew's algorithm.
+ * @return 'true' if passed. 
+ */
+template <typename Functor>
+bool testDynamicAndParallelConvexHull2D( const std::string & name )
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  typedef typename Functor::Point Point;
+  typedef PredicateFromOrientationFunctor2<Functor> Predicate; 
+  Functor functor; 
+  Predicate predicate( functor ); 
+  using namespace functions::Hull2D; 
+
+  trace.beginBlock ( "Dynamic and parallel convex hulls with " + name );
+
+  //degenerate cases
+  DynamicConvexHull2D<Point, Functor> hull( functor ); 
+  nbok += ( hull.empty() && hull.size() == 0 && hull.isValid() ) ? 1 : 0; 
+  nb++;
+  hull.add( Point(1,1) ); 
+  hull.add( Point(1,1) ); 
+  nbok += ( hull.size() == 1 && hull.isInside( Point(1,1) ) 
+	    && ! hull.isInside( Point(1,2) ) ) ? 1 : 0; 
+  nb++;
+  hull.add( Point(3,3) ); 
+  hull.add( Point(2,2) ); 
+  nbok += ( hull.size() == 2 && hull.isInside( Point(2,2) ) 
+	    && ! hull.isInside( Point(4,4) ) ) ? 1 : 0; 
+  nb++;
+  trace.info() << hull << " (" << nbok << "/" << nb << ") " << endl;
+
+  const int numberOfTries = 20; 
+  for (int i = 0; ( (i < numberOfTries)&&(nbok == nb) ); i++)
+    {
+      //small coordinates yield many duplicated and aligned points 
+      const int side = ( i % 2 == 0 ) ? 16 : 1024; 
+      const int numberOfPoints = 200 * ( i + 1 ) * ( i + 1 ); 
+      vector<Point> randomData, res1, res2, res3; 
+      for (int j = 0; j < numberOfPoints; j++)
+	randomData.push_back( Point(rand()%side, rand()%side) ); 
+      andrewConvexHullAlgorithm( randomData.begin(), randomData.end(), back_inserter( res1 ), predicate );   
+
+      hull.clear(); 
+      hull.add( randomData.begin(), randomData.end() ); 
+      hull.getVertices( back_inserter( res2 ) ); 
+      if ( (res1.size() == res2.size()) && hull.isValid() && 
+	   (circularlyEqual(res1.begin(), res1.end(), res2.begin(), res2.end())) )
+	nbok++; 
+      nb++; 
+
+      //every input point lies in the hull, its translations do not all
+      unsigned int nbIn = 0, nbOut = 0; 
+      for (unsigned int j = 0; j < randomData.size(); j++)
+	{
+	  nbIn += hull.isInside( randomData[ j ] ) ? 1 : 0; 
+	  nbOut += hull.isInside( randomData[ j ] + Point( side, 0 ) ) ? 0 : 1; 
+	}
+      if ( (nbIn == randomData.size()) && (nbOut > 0) )
+	nbok++; 
+      nb++; 
+
+      parallelConvexHullAlgorithm( randomData.begin(), randomData.end(), back_inserter( res3 ), functor, 7 );   
+      if ( (res1.size() == res3.size()) && 
+	   (circularlyEqual(res1.begin(), res1.end(), res3.begin(), res3.end())) )
+	nbok++; 
+      nb++; 
+      trace.info() << "(" << nbok << "/" << nb << ") " << endl;
+    }
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
 /**
  * Testing functions that computes the convex hull thickness.
  * @return 'true' if passed. 
@@ -341,7 +421,12 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testConvexHull2D() &&testConvexHullCompThickness();
+  typedef PointVector<2,DGtal::int32_t> Point;
+  typedef InHalfPlaneBySimple3x3Matrix<Point, DGtal::int64_t> Functor;  
+  typedef InHalfPlaneBy2x2DetComputer<Point, AvnaimEtAl2x2DetSignComputer<double> > AvnaimFunctor;  
+  bool res = testConvexHull2D() &&testConvexHullCompThickness()
+    && testDynamicAndParallelConvexHull2D<Functor>( "InHalfPlaneBySimple3x3Matrix" )
+    && testDynamicAndParallelConvexHull2D<AvnaimFunctor>( "AvnaimEtAl2x2DetSignComputer" );
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
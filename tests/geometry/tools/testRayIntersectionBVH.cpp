@@ -0,0 +1,216 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testRayIntersectionBVH.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/19
+ *
+ * Tests the ray queries of class RayIntersectionBVH against the
+ * linear scans of RayIntersectionPredicate.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/shapes/Shapes.h"
+#include "DGtal/shapes/Mesh.h"
+#include "DGtal/shapes/MeshHelpers.h"
+#include "DGtal/topology/DigitalSetBoundary.h"
+#include "DGtal/geometry/tools/RayIntersectionPredicates.h"
+#include "DGtal/geometry/tools/RayIntersectionBVH.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace Z3i;
+
+typedef RayIntersectionBVH< RealPoint > BVH;
+
+SCENARIO( "RayIntersectionBVH over the surfels of a digital ball", "[bvh][ray]" )
+{
+  typedef DigitalSetBoundary< KSpace, DigitalSet > Boundary;
+  const Point p1( -12, -12, -12 );
+  const Point p2(  12,  12,  12 );
+  KSpace K;
+  K.init( p1, p2, true );
+  DigitalSet aSet( Domain( p1, p2 ) );
+  Shapes<Domain>::addNorm2Ball( aSet, Point( 0, 0, 0 ), 9 );
+  Boundary boundary( K, aSet );
+  const std::vector< SCell > surfels( boundary.begin(), boundary.end() );
+  BVH bvh;
+  bvh.addSurfels( surfels.begin(), surfels.end() );
+  bvh.build();
+  // Rays with integer Khalimsky coordinates, so that predicates are exact.
+  std::vector< Point > iorigins, idirections;
+  BVH::RealPoints origins;
+  BVH::RealVectors directions;
+  srand( 0 );
+  for ( int i = 0; i < 1000; ++i )
+    {
+      const Point o( rand() % 61 - 30, rand() % 61 - 30, rand() % 61 - 30 );
+      Point d( rand() % 21 - 10, rand() % 21 - 10, rand() % 21 - 10 );
+      if ( d == Point::zero ) d = Point( 1, 2, 3 );
+      iorigins.push_back( o );
+      idirections.push_back( d );
+      origins.push_back( RealPoint( o ) );
+      directions.push_back( RealVector( d ) );
+    }
+  THEN( "The hierarchy contains two triangles per surfel" ) {
+    REQUIRE( bvh.isValid() );
+    REQUIRE( bvh.nbTriangles() == 2 * surfels.size() );
+    REQUIRE( bvh.nbNodes() > 0 );
+  }
+  THEN( "Occlusion is the one of the linear scan of RayIntersectionPredicate" ) {
+    const std::vector< bool > hits = bvh.intersects( origins, directions );
+    unsigned int nb_ok = 0, nb_hits = 0;
+    for ( std::size_t i = 0; i < origins.size(); ++i )
+      {
+        RayIntersectionPredicate< Point > ray( iorigins[ i ], idirections[ i ] );
+        const bool expected = std::any_of( surfels.begin(), surfels.end(), ray );
+        nb_hits += expected ? 1 : 0;
+        nb_ok   += ( hits[ i ] == expected )
+          && ( bvh.intersects( origins[ i ], directions[ i ] ) == expected ) ? 1 : 0;
+      }
+    REQUIRE( nb_hits > 100 );
+    REQUIRE( nb_ok == origins.size() );
+  }
+  THEN( "Closest intersections are intersected surfels with no surfel before them" ) {
+    const BVH::Intersections closest = bvh.closestIntersections( origins, directions );
+    unsigned int nb_ok = 0;
+    for ( std::size_t i = 0; i < origins.size(); ++i )
+      {
+        const BVH::Intersection single = bvh.closestIntersection( origins[ i ], directions[ i ] );
+        const bool same = ( single.primitive == closest[ i ].primitive )
+          && ( single.distance == closest[ i ].distance );
+        if ( ! closest[ i ].isValid() )
+          {
+            nb_ok += same && ! bvh.intersects( origins[ i ], directions[ i ] ) ? 1 : 0;
+            continue;
+          }
+        RayIntersectionPredicate< Point > ray( iorigins[ i ], idirections[ i ] );
+        const double t = closest[ i ].distance;
+        nb_ok += same && ray( surfels[ closest[ i ].primitive ] )
+          && ! bvh.intersects( origins[ i ], directions[ i ], t - 1e-9 ) ? 1 : 0;
+      }
+    REQUIRE( nb_ok == origins.size() );
+  }
+  THEN( "Inside tests give the digital ball" ) {
+    BVH::RealPoints points;
+    std::vector< bool > expected;
+    for ( auto p : Domain( p1, p2 ) )
+      {
+        points.push_back( RealPoint( 2 * p[ 0 ] + 1, 2 * p[ 1 ] + 1, 2 * p[ 2 ] + 1 ) );
+        expected.push_back( aSet( p ) );
+      }
+    const std::vector< bool > inside = bvh.areInside( points );
+    REQUIRE( inside == expected );
+    unsigned int nb_ok = 0;
+    for ( std::size_t i = 0; i < points.size(); i += 97 )
+      nb_ok += bvh.isInside( points[ i ] ) == expected[ i ] ? 1 : 0;
+    REQUIRE( nb_ok == ( points.size() + 96 ) / 97 );
+  }
+}
+
+SCENARIO( "RayIntersectionBVH over meshes", "[bvh][ray]" )
+{
+  // The unit cube, with quad faces.
+  Mesh< RealPoint > mesh;
+  for ( int i = 0; i < 8; ++i )
+    mesh.addVertex( RealPoint( i & 1, ( i >> 1 ) & 1, ( i >> 2 ) & 1 ) );
+  mesh.addQuadFace( 0, 2, 3, 1 );
+  mesh.addQuadFace( 4, 5, 7, 6 );
+  mesh.addQuadFace( 0, 1, 5, 4 );
+  mesh.addQuadFace( 2, 6, 7, 3 );
+  mesh.addQuadFace( 0, 4, 6, 2 );
+  mesh.addQuadFace( 1, 3, 7, 5 );
+  GIVEN( "A mesh" ) {
+    BVH bvh;
+    bvh.addMesh( mesh );
+    bvh.build();
+    THEN( "The thickness of the cube along face normals is one" ) {
+      BVH::RealPoints  origins;
+      BVH::RealVectors directions;
+      for ( unsigned int f = 0; f < mesh.nbFaces(); ++f )
+        {
+          const RealPoint c = mesh.getFaceBarycenter( f );
+          const RealVector n = RealVector( 0.5, 0.5, 0.5 ) - c;
+          origins.push_back( c + 0.001 * n );
+          directions.push_back( n / n.norm() );
+        }
+      const BVH::Intersections hits = bvh.closestIntersections( origins, directions );
+      REQUIRE( bvh.nbTriangles() == 12 );
+      for ( unsigned int f = 0; f < mesh.nbFaces(); ++f )
+        {
+          REQUIRE( hits[ f ].isValid() );
+          REQUIRE( hits[ f ].primitive == ( f ^ 1 ) );
+          REQUIRE( hits[ f ].distance == Approx( 0.9995 ) );
+        }
+    }
+    THEN( "Visibility is limited by the parameter bound" ) {
+      REQUIRE( bvh.intersects( RealPoint( 0.5, 0.5, 0.5 ), RealVector( 0.0, 0.0, 1.0 ), 0.6 ) );
+      REQUIRE( ! bvh.intersects( RealPoint( 0.5, 0.5, 0.5 ), RealVector( 0.0, 0.0, 1.0 ), 0.4 ) );
+      REQUIRE( ! bvh.intersects( RealPoint( 0.5, 0.5, 2.0 ), RealVector( 0.0, 0.0, 1.0 ) ) );
+      REQUIRE( bvh.countIntersections( RealPoint( 0.5, 0.5, 2.0 ), RealVector( 0.1, 0.2, -1.0 ) ) == 2 );
+      REQUIRE( bvh.isInside( RealPoint( 0.25, 0.5, 0.75 ) ) );
+      REQUIRE( ! bvh.isInside( RealPoint( 1.25, 0.5, 0.75 ) ) );
+    }
+    THEN( "Rays through the diagonals of the quads cross the faces once" ) {
+      REQUIRE( bvh.countIntersections( RealPoint( 0.25, 0.25, 2.0 ), RealVector( 0.0, 0.0, -1.0 ) ) == 2 );
+      REQUIRE( bvh.countIntersections( RealPoint( 0.25, 0.25, 0.5 ), RealVector( 0.0, 0.0, -1.0 ) ) == 1 );
+      REQUIRE( bvh.countIntersections( RealPoint( 0.75, 0.75, 0.5 ), RealVector( 0.0, 0.0, 1.0 ) ) == 1 );
+      REQUIRE( bvh.countIntersections( RealPoint( 2.0, 0.5, 0.5 ), RealVector( -1.0, 0.0, 0.0 ) ) == 2 );
+    }
+  }
+  GIVEN( "A triangulated surface" ) {
+    TriangulatedSurface< RealPoint > trisurf;
+    REQUIRE( MeshHelpers::mesh2TriangulatedSurface( mesh, trisurf ) );
+    BVH bvh;
+    bvh.addTriangulatedSurface( trisurf );
+    bvh.build();
+    THEN( "Rays hit the faces of the triangulated surface" ) {
+      const BVH::Intersection hit
+        = bvh.closestIntersection( RealPoint( 0.3, 0.6, -1.0 ), RealVector( 0.0, 0.0, 2.0 ) );
+      REQUIRE( bvh.nbTriangles() == 12 );
+      REQUIRE( hit.isValid() );
+      REQUIRE( hit.primitive < trisurf.nbFaces() );
+      REQUIRE( hit.distance == Approx( 0.5 ) );
+      REQUIRE( bvh.isInside( RealPoint( 0.7, 0.2, 0.4 ) ) );
+    }
+    THEN( "Rays through the shared edges cross the surface once" ) {
+      // Through the edges of the cube and the diagonals of its faces.
+      REQUIRE( bvh.countIntersections( RealPoint( -1.0, 0.5, -1.0 ), RealVector( 1.0, 0.0, 1.0 ) ) == 2 );
+      REQUIRE( bvh.countIntersections( RealPoint( 0.5, 0.5, 0.5 ), RealVector( 1.0, 0.0, 1.0 ) ) == 1 );
+      REQUIRE( bvh.countIntersections( RealPoint( 0.5, 0.5, 0.5 ), RealVector( 1.0, 0.0, 0.0 ) ) == 1 );
+      REQUIRE( bvh.countIntersections( RealPoint( 0.5, 0.5, -1.0 ), RealVector( 0.0, 0.0, 1.0 ) ) == 2 );
+      const BVH::RealPoints points = { RealPoint( 0.5, 0.5, 0.5 ), RealPoint( 0.25, 0.25, 0.25 ),
+                                       RealPoint( 1.5, 0.5, 0.5 ), RealPoint( -0.5, -0.5, -0.5 ) };
+      const std::vector< bool > expected = { true, true, false, false };
+      REQUIRE( bvh.areInside( points ) == expected );
+    }
+  }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -106,6 +106,80 @@ bool testVoronoiCovarianceMeasure()
   return nbok == nb;
 }
 
+/**
+ * Sparse mode must give the same VCM as the Voronoi map, up to the
+ * attribution of points equidistant to several sites.
+ */
+bool testSparseVoronoiCovarianceMeasure()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  using namespace DGtal;
+  using namespace DGtal::Z3i; // gets Space, Point, Domain
+  trace.beginBlock ( "testSparseVoronoiCovarianceMeasure" );
+  typedef ExactPredicateLpSeparableMetric<Space,2> Metric;
+  typedef VoronoiCovarianceMeasure<Space, Metric> VCM;
+  typedef VCM::MatrixNN Matrix;
+
+  // Points on a sphere of radius 12, plus a far away point.
+  std::vector<Point> pts;
+  Domain domain( Point::diagonal( -13 ), Point::diagonal( 13 ) );
+  for ( Domain::ConstIterator it = domain.begin(), itE = domain.end(); it != itE; ++it )
+    {
+      const Point p = *it;
+      const Point::Coordinate n2 = p.dot( p );
+      if ( 132 <= n2 && n2 < 156 ) pts.push_back( p );
+    }
+  pts.push_back( Point( 50, 40, 30 ) );
+  Metric l2;
+  VCM dense( 5.0, 3.0, l2, false, false );
+  VCM sparse( 5.0, 3.0, l2, false, true );
+  dense.init( pts.begin(), pts.end() );
+  sparse.init( pts.begin(), pts.end() );
+  nbok += ( dense.points() == sparse.points() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same sites: " << sparse.points().size() << std::endl;
+
+  double trace_dense = 0.0, trace_sparse = 0.0;
+  unsigned int nbsame = 0;
+  for ( std::size_t i = 0; i < dense.points().size(); ++i )
+    {
+      const Matrix & md = dense.matrices()[ i ];
+      const Matrix & ms = sparse.matrices()[ i ];
+      trace_dense  += md( 0, 0 ) + md( 1, 1 ) + md( 2, 2 );
+      trace_sparse += ms( 0, 0 ) + ms( 1, 1 ) + ms( 2, 2 );
+      nbsame += ( md == ms ) ? 1 : 0;
+    }
+  nbok += ( trace_dense == trace_sparse ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "trace(VCM) dense=" << trace_dense
+               << " sparse=" << trace_sparse
+               << " (identical cells: " << nbsame << ")" << std::endl;
+  const Matrix far_vcm = sparse.vcmMap().find( Point( 50, 40, 30 ) )->second;
+  nbok += ( far_vcm == dense.vcmMap().find( Point( 50, 40, 30 ) )->second 
+            && far_vcm( 0, 0 ) > 0.0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "isolated site has the same VCM" << std::endl;
+
+  functors::HatPointFunction< Point, double > chi_r( 1.0, 3.0 );
+  std::vector<Matrix> measures;
+  sparse.measure( chi_r, sparse.points().begin(), sparse.points().end(), measures );
+  unsigned int nbmeasures = 0;
+  for ( std::size_t i = 0; i < measures.size(); ++i )
+    nbmeasures += ( measures[ i ] == sparse.measure( chi_r, sparse.points()[ i ] ) ) ? 1 : 0;
+  nbok += ( nbmeasures == sparse.points().size() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "batch measure == measure" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -114,7 +188,8 @@ int main( int /* argc */, char** /* argv */ )
   using namespace std;
   using namespace DGtal;
   trace.beginBlock ( "Testing VoronoiCovarianceMeasure ..." );
-  bool res = testVoronoiCovarianceMeasure();
+  bool res = testVoronoiCovarianceMeasure()
+    && testSparseVoronoiCovarianceMeasure();
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
@@ -35,6 +35,10 @@
 #include "DGtal/helpers/StdDefs.h"
 #include "DGtal/shapes/Shapes.h"
 #include "DGtal/kernel/CPointPredicate.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
 ///////////////////////////////////////////////////////////////////////////////
 
 using namespace std;
@@ -93,6 +97,62 @@ bool testKanungo2D()
   return nbok == nb;
 }
 
+/**
+ * The noise written into a binary image must be the one of the
+ * KanungoNoise predicate, and must not depend on the number of
+ * threads.
+ */
+bool testKanungoImage3D()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing Kanungo noise into a binary image ..." );
+
+  typedef ImageContainerBySTLVector<Z3i::Domain, bool> BinaryImage;
+  typedef KanungoNoise<Z3i::DigitalSet, Z3i::Domain> Kanungo;
+  Z3i::Domain domain(Z3i::Point(-2,-3,-1), Z3i::Point(30,27,25));
+  Z3i::DigitalSet set(domain);
+  Shapes<Z3i::Domain>::addNorm2Ball( set , Z3i::Point(14,12,12), 9);
+
+  Kanungo noisified( set, domain, 0.5, 17 );
+  BinaryImage image( domain );
+  Kanungo::noisify( image, set, domain, 0.5, 17 );
+  unsigned int nbdiff = 0, nbflip = 0;
+  for ( auto p : domain )
+    {
+      nbdiff += ( image( p ) != noisified( p ) ) ? 1 : 0;
+      nbflip += ( image( p ) != set( p ) ) ? 1 : 0;
+    }
+  trace.info() << "flipped points: " << nbflip << std::endl;
+  nbok += ( nbdiff == 0 && nbflip > 0 ) ? 1 : 0;
+  nb++;
+
+#ifdef WITH_OPENMP
+  const int nbThreads = omp_get_max_threads();
+  omp_set_num_threads( 1 );
+  BinaryImage image1( domain );
+  Kanungo::noisify( image1, set, domain, 0.5, 17 );
+  omp_set_num_threads( 4 );
+  BinaryImage image4( domain );
+  Kanungo::noisify( image4, set, domain, 0.5, 17 );
+  omp_set_num_threads( nbThreads );
+  nbok += ( std::equal( image1.begin(), image1.end(), image.begin() )
+            && std::equal( image4.begin(), image4.end(), image.begin() ) ) ? 1 : 0;
+  nb++;
+#endif
+
+  // Another seed gives another noise.
+  BinaryImage other( domain );
+  Kanungo::noisify( other, set, domain, 0.5, 18 );
+  nbok += ( ! std::equal( other.begin(), other.end(), image.begin() ) ) ? 1 : 0;
+  nb++;
+
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "noisify() == KanungoNoise" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
 bool CheckingConcept()
 {
   BOOST_CONCEPT_ASSERT(( concepts::CPointPredicate < KanungoNoise<Z2i::DigitalSet, Z2i::Domain> > ));
@@ -111,7 +171,7 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = CheckingConcept() && testKanungo2D(); // && ... other tests
+  bool res = CheckingConcept() && testKanungo2D() && testKanungoImage3D(); // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
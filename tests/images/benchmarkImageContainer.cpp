@@ -40,6 +40,8 @@
 #include "DGtal/helpers/StdDefs.h"
 #include <map>
 #include <string>
+#include <vector>
+#include <utility>
 
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -162,6 +164,72 @@ static void BM_DomainScan(benchmark::State& state)
 BENCHMARK_TEMPLATE(BM_DomainScan, ImageVector2)->Range(1<<3 , 1 << 10);
 BENCHMARK_TEMPLATE(BM_DomainScan, ImageMap2)->Range(1<<3 , 1 << 10);
 
+typedef DGtal::ImageContainerBySTLVector< Z3i::Domain, DGtal::int32_t> ImageVector3;
+typedef DGtal::ImageContainerBySTLMap< Z3i::Domain, DGtal::int32_t> ImageMap3;
+typedef DGtal::experimental::ImageContainerByHashTree< Z3i::Domain, DGtal::int32_t> ImageHash3;
+
+/// Sparse labelled volume: labelled cubes of side 8 at random positions.
+std::vector< std::pair<Z3i::Point, DGtal::int32_t> > ConstructSparseLabels(unsigned int width)
+{
+  std::vector< std::pair<Z3i::Point, DGtal::int32_t> > v;
+  const unsigned int nbCubes = width / 4;
+  for (unsigned int i = 0; i < nbCubes; ++i)
+    {
+      const Z3i::Point c( rand() % (width - 8), rand() % (width - 8), rand() % (width - 8) );
+      for(auto p : Z3i::Domain( c, c + Z3i::Point::diagonal(7) ))
+        v.push_back( std::make_pair( p, DGtal::int32_t( 1 + i % 16 ) ) );
+    }
+  return v;
+}
+
+template<typename Q, typename Iterator>
+void FillImage(Q& image, Iterator itb, Iterator itend)
+{
+  for( ; itb != itend; ++itb)
+    image.setValue( itb->first, itb->second );
+}
+
+template<typename Iterator>
+void FillImage(ImageHash3& image, Iterator itb, Iterator itend)
+{
+  image.buildFromRange( itb, itend );
+}
+
+template<typename Q>
+static void BM_SparseLabelBuild(benchmark::State& state)
+{
+  const std::vector< std::pair<Z3i::Point, DGtal::int32_t> > data = ConstructSparseLabels(state.range(0));
+  while (state.KeepRunning())
+    {
+      state.PauseTiming();
+      Z3i::Domain dom(Z3i::Point::diagonal(0), Z3i::Point::diagonal(state.range(0) - 1));
+      state.ResumeTiming();
+      Q image( dom );
+      FillImage( image, data.begin(), data.end() );
+    }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*data.size());
+}
+BENCHMARK_TEMPLATE(BM_SparseLabelBuild, ImageVector3)->Range(1<<5 , 1 << 9);
+BENCHMARK_TEMPLATE(BM_SparseLabelBuild, ImageMap3)->Range(1<<5 , 1 << 9);
+BENCHMARK_TEMPLATE(BM_SparseLabelBuild, ImageHash3)->Range(1<<5 , 1 << 9);
+
+template<typename Q>
+static void BM_SparseLabelGet(benchmark::State& state)
+{
+  const std::vector< std::pair<Z3i::Point, DGtal::int32_t> > data = ConstructSparseLabels(state.range(0));
+  Z3i::Domain dom(Z3i::Point::diagonal(0), Z3i::Point::diagonal(state.range(0) - 1));
+  Q image( dom );
+  FillImage( image, data.begin(), data.end() );
+  int64_t sum = 0;
+  while (state.KeepRunning())
+    for(auto it = data.begin(), itend = data.end(); it != itend; ++it)
+      benchmark::DoNotOptimize( sum += image( it->first ) );
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*data.size());
+}
+BENCHMARK_TEMPLATE(BM_SparseLabelGet, ImageVector3)->Range(1<<5 , 1 << 9);
+BENCHMARK_TEMPLATE(BM_SparseLabelGet, ImageMap3)->Range(1<<5 , 1 << 9);
+BENCHMARK_TEMPLATE(BM_SparseLabelGet, ImageHash3)->Range(1<<5 , 1 << 9);
+
 
 
 
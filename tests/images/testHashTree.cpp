@@ -29,6 +29,8 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <vector>
+#include <algorithm>
 #include "DGtal/base/Common.h"
 
 #include "DGtal/io/boards/Board2D.h"
@@ -273,6 +275,91 @@ bool testBadKeySizes()
   return true;  
 }
 
+/**
+ * Bulk construction from (point, value) pairs, against setValue.
+ */
+bool testBuildFromRange()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  typedef experimental::ImageContainerByHashTree<Z3i::Domain, int> Image;
+  typedef std::pair<Z3i::Point, int> PointValue;
+
+  trace.beginBlock ( "Bulk construction of a sparse labelled volume" );
+  Z3i::Domain domain( Z3i::Point( -3, -2, 0 ), Z3i::Point( 40, 35, 37 ) );
+  std::vector<PointValue> values;
+  srand( 0 );
+  for ( unsigned int i = 0; i < 2000; ++i )
+    {
+      const Z3i::Point p( rand() % 44 - 3, rand() % 38 - 2, rand() % 38 );
+      values.push_back( PointValue( p, 1 + rand() % 3 ) );
+    }
+  // A full labelled block, that must collapse into a few leaves.
+  for ( auto p : Z3i::Domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 15, 15, 15 ) ) )
+    values.push_back( PointValue( p, 7 ) );
+
+  Image bulk( domain, 8, 0 );
+  bulk.buildFromRange( values.begin(), values.end() );
+  Image incremental( domain, 8, 0 );
+  for ( std::vector<PointValue>::const_iterator it = values.begin(), itend = values.end();
+        it != itend; ++it )
+    incremental.setValue( it->first, it->second );
+
+  unsigned int nbequal = 0;
+  for ( auto p : domain )
+    nbequal += ( bulk( p ) == incremental( p ) ) ? 1 : 0;
+  nbok += ( nbequal == domain.size() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "bulk == setValue on all points" << std::endl;
+  nbok += ( bulk.getNbNodes() <= incremental.getNbNodes() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "nodes: bulk=" << bulk.getNbNodes()
+               << " setValue=" << incremental.getNbNodes() << std::endl;
+
+  // Copies own their nodes.
+  Image copy( bulk );
+  Image assigned( Z3i::Domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 3, 3, 3 ) ), 3, 0 );
+  assigned = bulk;
+  bulk.setValue( Z3i::Point( 20, 20, 20 ), 42 );
+  nbequal = 0;
+  for ( auto p : domain )
+    nbequal += ( copy( p ) == incremental( p ) && assigned( p ) == incremental( p ) ) ? 1 : 0;
+  nbok += ( nbequal == domain.size() && bulk( Z3i::Point( 20, 20, 20 ) ) == 42 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "copy and assignment" << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock ( "Bulk construction: collapsing and unsorted input" );
+  typedef experimental::ImageContainerByHashTree<Z2i::Domain, int> Image2;
+  Z2i::Domain domain2( Z2i::Point( 0, 0 ), Z2i::Point( 7, 7 ) );
+  std::vector< std::pair<Z2i::Point, int> > full;
+  for ( auto p : domain2 )
+    full.push_back( std::make_pair( p, 5 ) );
+  // Duplicate, unsorted values: the last one is kept.
+  full.push_back( std::make_pair( Z2i::Point( 3, 4 ), 2 ) );
+  full.push_back( std::make_pair( Z2i::Point( 0, 0 ), 5 ) );
+  std::reverse( full.begin(), full.end() - 2 );
+  Image2 image2( domain2, 2, 0 );
+  image2.buildFromRange( full.begin(), full.end() );
+  nbok += ( image2( Z2i::Point( 3, 4 ) ) == 2 && image2( Z2i::Point( 7, 1 ) ) == 5 ) ? 1 : 0;
+  nb++;
+  nbok += ( image2.isValid() ) ? 1 : 0;
+  nb++;
+  full.pop_back();
+  full.pop_back();
+  image2.buildFromRange( full.begin(), full.end() );
+  nbok += ( image2.getNbNodes() == 1 && image2( Z2i::Point( 3, 4 ) ) == 5 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "homogeneous image is a single leaf" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
 //////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -284,7 +371,8 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << std::endl;
 
-  bool res = testHashTree() && testHashTree2D() && testGetSetVal() && testBadKeySizes();  // && ... other tests
+  bool res = testHashTree() && testHashTree2D() && testGetSetVal() && testBadKeySizes()
+    && testBuildFromRange();  // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << std::endl;
   trace.endBlock();
   return res ? 0 : 1;
@@ -0,0 +1,153 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testImageContainerByMappedRawFile.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing class ImageContainerByMappedRawFile.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <fstream>
+#include "DGtal/base/Common.h"
+#include "ConfigTest.h"
+#include "DGtalCatch.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/CImage.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageContainerByMappedRawFile.h"
+#include "DGtal/io/readers/RawReader.h"
+#include "DGtal/io/writers/RawWriter.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace Z3i;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ImageContainerByMappedRawFile.
+///////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE( "Testing ImageContainerByMappedRawFile" )
+{
+  typedef ImageContainerBySTLVector<Domain, DGtal::uint16_t> Image;
+  typedef ImageContainerByMappedRawFile<Domain, DGtal::uint16_t> MappedImage;
+  BOOST_CONCEPT_ASSERT(( concepts::CImage< MappedImage > ));
+
+  Domain domain( Point( 0, 0, 0 ), Point( 31, 20, 9 ) );
+  Image image( domain );
+  for ( auto p : domain )
+    image.setValue( p, (DGtal::uint16_t)( p[0] + 256 * p[1] + 17 * p[2] ) );
+  RawWriter<Image>::exportRaw16( "testMappedRawFile.raw", image );
+
+  SECTION("Read-only mapping gives the same values as RawReader")
+  {
+    Image read = RawReader<Image>::importRaw16( "testMappedRawFile.raw",
+                                                domain.upperBound() + Point::diagonal( 1 ) );
+    MappedImage mapped( "testMappedRawFile.raw", domain, MappedImage::READ_ONLY,
+                        MappedImage::LITTLE_ENDIAN_ORDER );
+    REQUIRE( mapped.isValid() );
+    REQUIRE( std::equal( read.begin(), read.end(), mapped.constRange().begin() ) );
+    REQUIRE( mapped( Point( 3, 4, 5 ) ) == image( Point( 3, 4, 5 ) ) );
+    REQUIRE( *( mapped.constRange().begin( Point( 7, 2, 1 ) ) ) == image( Point( 7, 2, 1 ) ) );
+  }
+
+  SECTION("Copy-on-write mapping never alters the file")
+  {
+    {
+      MappedImage mapped( "testMappedRawFile.raw", domain, MappedImage::COPY_ON_WRITE,
+                          MappedImage::LITTLE_ENDIAN_ORDER );
+      mapped.setValue( Point( 1, 1, 1 ), 4242 );
+      REQUIRE( mapped( Point( 1, 1, 1 ) ) == 4242 );
+      MappedImage::Range r = mapped.range();
+      std::fill( r.begin(), r.end(), 7 );
+      REQUIRE( mapped( Point( 31, 20, 9 ) ) == 7 );
+    }
+    MappedImage mapped( "testMappedRawFile.raw", domain, MappedImage::READ_ONLY,
+                        MappedImage::LITTLE_ENDIAN_ORDER );
+    REQUIRE( mapped( Point( 1, 1, 1 ) ) == image( Point( 1, 1, 1 ) ) );
+  }
+
+  SECTION("Read-only images can't be modified")
+  {
+    MappedImage mapped( "testMappedRawFile.raw", domain );
+    REQUIRE_THROWS_AS( mapped.setValue( Point( 1, 1, 1 ), 4242 ), IOException );
+    REQUIRE_THROWS_AS( mapped.range(), IOException );
+    REQUIRE_THROWS_AS( mapped.begin(), IOException );
+    const MappedImage & cmapped = mapped;
+    REQUIRE( std::equal( image.begin(), image.end(), cmapped.begin() ) );
+  }
+
+  SECTION("Copies of an image are independent")
+  {
+    MappedImage mapped( "testMappedRawFile.raw", domain, MappedImage::COPY_ON_WRITE );
+    MappedImage copy( mapped );
+    MappedImage other( "testMappedRawFile.raw", domain, MappedImage::COPY_ON_WRITE );
+    other = mapped;
+    copy.setValue( Point( 1, 1, 1 ), 4242 );
+    REQUIRE( copy( Point( 1, 1, 1 ) ) == 4242 );
+    REQUIRE( mapped( Point( 1, 1, 1 ) ) == image( Point( 1, 1, 1 ) ) );
+    REQUIRE( other( Point( 1, 1, 1 ) ) == image( Point( 1, 1, 1 ) ) );
+    std::fill( mapped.begin(), mapped.end(), 7 );
+    REQUIRE( mapped( Point( 2, 3, 4 ) ) == 7 );
+    REQUIRE( copy( Point( 2, 3, 4 ) ) == image( Point( 2, 3, 4 ) ) );
+    REQUIRE( other( Point( 2, 3, 4 ) ) == image( Point( 2, 3, 4 ) ) );
+    REQUIRE( copy.isValid() );
+  }
+
+  SECTION("Header offset and big-endian values")
+  {
+    std::ofstream out( "testMappedRawFileBE.raw", std::ios::binary );
+    out << "HEADER!!";
+    for ( auto v : image )
+      out.put( (char)( v >> 8 ) ).put( (char)( v & 0xFF ) );
+    out.close();
+    const MappedImage mapped( "testMappedRawFileBE.raw", domain, MappedImage::COPY_ON_WRITE,
+                              MappedImage::BIG_ENDIAN_ORDER, 8 );
+    REQUIRE( std::equal( image.begin(), image.end(), mapped.begin() ) );
+    // Swapping needs a private mapping.
+    const MappedImage::Endianness foreign = MappedImage::isHostLittleEndian()
+      ? MappedImage::BIG_ENDIAN_ORDER : MappedImage::LITTLE_ENDIAN_ORDER;
+    REQUIRE_THROWS_AS( MappedImage( "testMappedRawFileBE.raw", domain, MappedImage::READ_ONLY,
+                                    foreign, 8 ), IOException );
+  }
+
+  SECTION("Misaligned headers raise an IOException")
+  {
+    REQUIRE_THROWS_AS( MappedImage( "testMappedRawFile.raw", domain, MappedImage::READ_ONLY,
+                                    MappedImage::NATIVE_ENDIAN, 7 ), IOException );
+    typedef ImageContainerByMappedRawFile<Domain, unsigned char> MappedByteImage;
+    const MappedByteImage bytes( "testMappedRawFile.raw", domain, MappedByteImage::READ_ONLY,
+                                 MappedByteImage::NATIVE_ENDIAN, 7 );
+    REQUIRE( bytes.isValid() );
+  }
+
+  SECTION("Files too short raise an IOException")
+  {
+    Domain bigger( Point( 0, 0, 0 ), Point( 31, 20, 10 ) );
+    REQUIRE_THROWS_AS( MappedImage( "testMappedRawFile.raw", bigger ), IOException );
+  }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
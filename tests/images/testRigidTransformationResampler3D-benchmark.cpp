@@ -0,0 +1,106 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testRigidTransformationResampler3D-benchmark.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/19
+ *
+ * Rigid transformation of a volume: ConstImageAdapter with a
+ * BackwardRigidTransformation3D versus RigidTransformationResampler3D
+ * (nearest and trilinear interpolations). By default, a 512^3 volume
+ * is used; the side of the volume may be given as first argument.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/base/BasicFunctors.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ConstImageAdapter.h"
+#include "DGtal/images/ImageHelper.h"
+#include "DGtal/images/RigidTransformation3D.h"
+#include "DGtal/images/RigidTransformationResampler3D.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace Z3i;
+using namespace DGtal::functors;
+
+typedef ImageContainerBySTLVector<Domain, unsigned char> Image;
+typedef BackwardRigidTransformation3D<Space> BackwardTrans;
+typedef ConstImageAdapter<Image, Domain, BackwardTrans, unsigned char, Identity> Adapter;
+typedef RigidTransformationResampler3D<Space> Resampler;
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  const int side = ( argc > 1 ) ? atoi( argv[ 1 ] ) : 512;
+  trace.beginBlock ( "Benchmarking rigid transformations of volumes" );
+  trace.info() << "Volume " << side << "^3" << std::endl;
+
+  Domain domain( Point::zero, Point::diagonal( side - 1 ) );
+  Image image( domain );
+  std::size_t i = 0;
+  for ( Image::Iterator it = image.begin(), itend = image.end(); it != itend; ++it, ++i )
+    *it = (unsigned char)( ( i * 2654435761UL ) >> 24 );
+
+  const RealPoint origin = RealPoint::diagonal( side / 2. );
+  const RealVector axis( 1, 2, 3 );
+  const double angle = 0.3;
+  const RealVector translation( 3.5, -2.25, 1 );
+  Resampler resampler( origin, axis, angle, translation );
+  // Same domain for all methods to compare the throughputs.
+  BackwardTrans backward( origin, axis, angle, translation );
+  Identity id;
+  Adapter adapter( image, domain, backward, id );
+
+  Clock c;
+  c.startClock();
+  Image a = evaluateImage( adapter );
+  trace.info() << "ConstImageAdapter + evaluateImage: " << c.stopClock() << " ms" << std::endl;
+
+  Image r( domain );
+  c.startClock();
+  resampler.resampleInto( image, r, Resampler::NEAREST );
+  trace.info() << "Resampler (nearest): " << c.stopClock() << " ms" << std::endl;
+
+  Image t( domain );
+  c.startClock();
+  resampler.resampleInto( image, t, Resampler::TRILINEAR );
+  trace.info() << "Resampler (trilinear): " << c.stopClock() << " ms" << std::endl;
+
+  std::size_t nbdiff = 0;
+  for ( std::size_t j = 0; j < a.size(); ++j )
+    nbdiff += ( a[ j ] != r[ j ] ) ? 1 : 0;
+  trace.info() << "Nearest values differing from the adapter: " << nbdiff << std::endl;
+
+  const bool res = ( nbdiff == 0 );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
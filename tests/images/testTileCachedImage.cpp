@@ -0,0 +1,131 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testTileCachedImage.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing class TileCachedImage and the evaluation of
+ * adapter chains (evaluateInto, evaluateImage).
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include "DGtal/base/Common.h"
+#include "ConfigTest.h"
+#include "DGtalCatch.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/base/BasicFunctors.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ConstImageAdapter.h"
+#include "DGtal/images/RigidTransformation3D.h"
+#include "DGtal/images/ImageHelper.h"
+#include "DGtal/images/TileCachedImage.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace Z3i;
+using namespace DGtal::functors;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class TileCachedImage.
+///////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE( "Testing evaluateInto and TileCachedImage on adapter chains" )
+{
+  typedef ImageContainerBySTLVector<Domain, int> Image;
+  typedef BackwardRigidTransformation3D<Space> BackwardTrans;
+  typedef ConstImageAdapter<Image, Domain, BackwardTrans, int, Identity> RotatedImage;
+  typedef ConstImageAdapter<RotatedImage, Domain, Identity, bool, Thresholder<int> > BinaryImage;
+
+  Domain domain( Point( -5, -3, 0 ), Point( 40, 30, 25 ) );
+  Image image( domain );
+  for ( auto p : domain )
+    image.setValue( p, ( p[ 0 ] * 7 + p[ 1 ] * 13 + p[ 2 ] * 5 ) % 100 );
+
+  BackwardTrans backward( RealPoint( 15, 12, 10 ), RealVector( 1, 0, 1 ), M_PI_4,
+                          RealVector( 2, -1, 3 ) );
+  Identity id;
+  Thresholder<int> thresholder( 50 );
+  Domain subdomain( Point( -2, 0, 1 ), Point( 33, 29, 20 ) );
+  RotatedImage rotated( image, subdomain, backward, id );
+  rotated.setDefaultValue( -1 );
+  BinaryImage binary( rotated, subdomain, id, thresholder );
+
+  SECTION("evaluateImage matches the adapter chain")
+  {
+    ImageContainerBySTLVector<Domain, int> r = evaluateImage( rotated );
+    ImageContainerBySTLVector<Domain, bool> b = evaluateImage( binary );
+    REQUIRE( r.domain().lowerBound() == subdomain.lowerBound() );
+    unsigned int nbok = 0;
+    for ( auto p : subdomain )
+      nbok += ( r( p ) == rotated( p ) && b( p ) == binary( p ) ) ? 1 : 0;
+    REQUIRE( nbok == subdomain.size() );
+  }
+
+  SECTION("evaluateInto a subdomain of the adapter domain")
+  {
+    Domain d( Point( 3, 4, 5 ), Point( 10, 10, 10 ) );
+    ImageContainerBySTLVector<Domain, double> r( d );
+    evaluateInto( rotated, r );
+    unsigned int nbok = 0;
+    for ( auto p : d )
+      nbok += ( r( p ) == (double) rotated( p ) ) ? 1 : 0;
+    REQUIRE( nbok == d.size() );
+  }
+
+  SECTION("TileCachedImage gives the values of the adapter chain")
+  {
+    for ( int size : { 1, 7, 64 } )
+      {
+        TileCachedImage<BinaryImage> cached( binary, size );
+        REQUIRE( cached.isValid() );
+        REQUIRE( cached.nbFilledTiles() == 0 );
+        unsigned int nbok = 0;
+        for ( auto p : subdomain )
+          nbok += ( cached( p ) == binary( p ) ) ? 1 : 0;
+        REQUIRE( nbok == subdomain.size() );
+        REQUIRE( cached.nbFilledTiles() == cached.nbTiles() );
+      }
+  }
+
+  SECTION("TileCachedImage fills tiles on demand")
+  {
+    TileCachedImage<RotatedImage> cached( rotated, 8 );
+    REQUIRE( cached.nbTiles() == 5 * 4 * 3 );
+    REQUIRE( cached( Point( 0, 0, 1 ) ) == rotated( Point( 0, 0, 1 ) ) );
+    REQUIRE( cached.nbFilledTiles() == 1 );
+    REQUIRE( cached( Point( 33, 29, 20 ) ) == rotated( Point( 33, 29, 20 ) ) );
+    REQUIRE( cached.nbFilledTiles() == 2 );
+    cached.fill();
+    REQUIRE( cached.nbFilledTiles() == cached.nbTiles() );
+    TileCachedImage<RotatedImage> copy( cached );
+    REQUIRE( copy.nbFilledTiles() == 0 );
+    REQUIRE( std::equal( copy.constRange().begin(), copy.constRange().end(),
+                         rotated.constRange().begin() ) );
+    cached.clear();
+    REQUIRE( cached.nbFilledTiles() == 0 );
+  }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,177 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testBlockStreamIO.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing class BlockStreamIO.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <sstream>
+#include "DGtal/base/Common.h"
+#include "ConfigTest.h"
+#include "DGtalCatch.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/base/BasicFunctors.h"
+#include "DGtal/io/BlockStreamIO.h"
+#include "DGtal/io/writers/LongvolWriter.h"
+#include "DGtal/io/readers/LongvolReader.h"
+#include "DGtal/io/writers/VolWriter.h"
+#include "DGtal/io/readers/VolReader.h"
+#include "DGtal/io/readers/PGMReader.h"
+#include "DGtal/io/writers/PGMWriter.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageContainerBySTLMap.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace Z3i;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class BlockStreamIO.
+///////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE( "Testing BlockStreamIO words" )
+{
+  std::vector<DGtal::uint64_t> values;
+  for ( DGtal::uint64_t i = 0; i < 1000; ++i )
+    values.push_back( i * 0x0102030405ULL + ( i << 56 ) );
+  functors::Identity id;
+
+  SECTION("Raw round trip with chunks smaller than the payload")
+  {
+    std::stringstream ss;
+    BlockStreamIO::writeWords<DGtal::uint64_t>( ss, values.begin(), values.size(),
+                                                false, id, 24 );
+    REQUIRE( ss.str().size() == values.size() * 8 );
+    std::vector<DGtal::uint64_t> read( values.size() );
+    BlockStreamIO::readWords<DGtal::uint64_t>( ss, values.size(), false,
+                                               read.begin(), id, 24 );
+    REQUIRE( read == values );
+  }
+
+  SECTION("Little-endian layout of the words")
+  {
+    std::stringstream ss;
+    std::vector<unsigned int> one( 1, 0x01020304 );
+    BlockStreamIO::writeWords<unsigned int>( ss, one.begin(), 1, false, id );
+    const std::string s = ss.str();
+    REQUIRE( s.size() == 4 );
+    REQUIRE( s[ 0 ] == 4 );
+    REQUIRE( s[ 3 ] == 1 );
+  }
+
+  SECTION("Compressed round trip with small chunks")
+  {
+    std::stringstream ss;
+    BlockStreamIO::writeWords<DGtal::uint64_t>( ss, values.begin(), values.size(),
+                                                true, id, 100 );
+    std::vector<DGtal::uint64_t> read( values.size() );
+    BlockStreamIO::readWords<DGtal::uint64_t>( ss, values.size(), true,
+                                               read.begin(), id, 17 );
+    REQUIRE( read == values );
+  }
+
+  SECTION("Truncated payloads raise an IOException")
+  {
+    std::stringstream ss;
+    BlockStreamIO::writeWords<DGtal::uint64_t>( ss, values.begin(), 10,
+                                                false, id );
+    std::vector<DGtal::uint64_t> read( values.size() );
+    REQUIRE_THROWS_AS( BlockStreamIO::readWords<DGtal::uint64_t>( ss, 11, false,
+                                                                  read.begin(), id ),
+                       IOException );
+  }
+}
+
+TEST_CASE( "Testing block-streamed volume formats" )
+{
+  Domain domain( Point( -3, -2, -1 ), Point( 40, 37, 35 ) );
+  typedef ImageContainerBySTLVector<Domain, unsigned char> Image;
+  typedef ImageContainerBySTLVector<Domain, DGtal::uint64_t> LongImage;
+  typedef ImageContainerBySTLMap<Domain, unsigned char> MapImage;
+  Image image( domain );
+  LongImage limage( domain );
+  for ( auto p : domain )
+    {
+      image.setValue( p, (unsigned char)( ( p[0] * 7 + p[1] * 3 + p[2] ) & 0xFF ) );
+      limage.setValue( p, (DGtal::uint64_t)( p[0] + 100 ) * 0x100000001ULL + p[2] );
+    }
+
+  SECTION("Vol, raw and compressed")
+  {
+    VolWriter<Image>::exportVol( "testBlockStreamIO.vol", image, false );
+    VolWriter<Image>::exportVol( "testBlockStreamIOz.vol", image, true );
+    Image a = VolReader<Image>::importVol( "testBlockStreamIO.vol" );
+    Image b = VolReader<Image>::importVol( "testBlockStreamIOz.vol" );
+    REQUIRE( a.domain().lowerBound() == domain.lowerBound() );
+    REQUIRE( std::equal( a.begin(), a.end(), image.begin() ) );
+    REQUIRE( std::equal( b.begin(), b.end(), image.begin() ) );
+  }
+
+  SECTION("Vol into a non-contiguous image container")
+  {
+    VolWriter<Image>::exportVol( "testBlockStreamIOz.vol", image, true );
+    MapImage m = VolReader<MapImage>::importVol( "testBlockStreamIOz.vol" );
+    unsigned int nbok = 0;
+    for ( auto p : domain )
+      nbok += ( m( p ) == image( p ) ) ? 1 : 0;
+    REQUIRE( nbok == domain.size() );
+  }
+
+  SECTION("Vol from a non-contiguous image container")
+  {
+    MapImage m( domain );
+    for ( auto p : domain ) m.setValue( p, image( p ) );
+    VolWriter<MapImage>::exportVol( "testBlockStreamIOm.vol", m, false );
+    Image a = VolReader<Image>::importVol( "testBlockStreamIOm.vol" );
+    REQUIRE( std::equal( a.begin(), a.end(), image.begin() ) );
+  }
+
+  SECTION("Longvol, raw and compressed")
+  {
+    LongvolWriter<LongImage>::exportLongvol( "testBlockStreamIO.longvol", limage, false );
+    LongvolWriter<LongImage>::exportLongvol( "testBlockStreamIOz.longvol", limage, true );
+    LongImage a = LongvolReader<LongImage>::importLongvol( "testBlockStreamIO.longvol" );
+    LongImage b = LongvolReader<LongImage>::importLongvol( "testBlockStreamIOz.longvol" );
+    REQUIRE( std::equal( a.begin(), a.end(), limage.begin() ) );
+    REQUIRE( std::equal( b.begin(), b.end(), limage.begin() ) );
+  }
+
+  SECTION("Binary PGM3D")
+  {
+    Domain d0( Point( 0, 0, 0 ), Point( 43, 39, 36 ) );
+    Image image0( d0 );
+    for ( auto p : d0 )
+      image0.setValue( p, (unsigned char)( ( p[0] + 5 * p[1] + 11 * p[2] ) & 0xFF ) );
+    PGMWriter<Image>::exportPGM3D( "testBlockStreamIO.pgm3d", image0, functors::Identity(), false );
+    Image a = PGMReader<Image>::importPGM3D( "testBlockStreamIO.pgm3d" );
+    REQUIRE( a.domain().upperBound() == d0.upperBound() );
+    REQUIRE( std::equal( a.begin(), a.end(), image0.begin() ) );
+  }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
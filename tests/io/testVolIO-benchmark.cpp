@@ -0,0 +1,131 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testVolIO-benchmark.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/19
+ *
+ * Read/write throughput of the vol, longvol and pgm3d formats. By
+ * default, a 1024^3 volume (1 GiB of voxels for vol/pgm3d) is used;
+ * the side of the volume may be given as first argument.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdio>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/io/readers/VolReader.h"
+#include "DGtal/io/writers/VolWriter.h"
+#include "DGtal/io/readers/LongvolReader.h"
+#include "DGtal/io/writers/LongvolWriter.h"
+#include "DGtal/io/readers/PGMReader.h"
+#include "DGtal/io/writers/PGMWriter.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace Z3i;
+
+typedef ImageContainerBySTLVector<Domain, unsigned char> Image;
+typedef ImageContainerBySTLVector<Domain, DGtal::uint64_t> LongImage;
+
+/// Outputs the throughput (in MiB/s) of an operation on @a bytes bytes.
+void report( const std::string & name, double bytes, double ms )
+{
+  trace.info() << name << ": " << ms << " ms, "
+               << ( bytes / 1048576.0 ) / ( ms / 1000.0 ) << " MiB/s" << std::endl;
+}
+
+template <typename TImage, typename TWrite, typename TRead>
+bool benchmark( const std::string & name, const std::string & filename,
+                const TImage & image, TWrite write, TRead read )
+{
+  const double bytes = (double) image.domain().size() * sizeof( typename TImage::Value );
+  trace.beginBlock( name );
+  Clock c;
+  c.startClock();
+  write( filename, image );
+  report( "write", bytes, c.stopClock() );
+  c.startClock();
+  TImage other = read( filename );
+  report( "read", bytes, c.stopClock() );
+  const bool ok = std::equal( other.begin(), other.end(), image.begin() );
+  std::remove( filename.c_str() );
+  trace.endBlock();
+  return ok;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  const int side = ( argc > 1 ) ? atoi( argv[ 1 ] ) : 1024;
+  trace.beginBlock ( "Benchmarking vol/longvol/pgm3d I/O" );
+  trace.info() << "Volume " << side << "^3" << std::endl;
+
+  Domain domain( Point::zero, Point::diagonal( side - 1 ) );
+  bool res = true;
+  {
+    Image image( domain );
+    std::size_t i = 0;
+    for ( Image::Iterator it = image.begin(), itend = image.end(); it != itend; ++it, ++i )
+      *it = (unsigned char)( ( i * 2654435761UL ) >> 24 );
+
+    res = res && benchmark( "vol (raw)", "benchVolIO.vol", image,
+                            []( const std::string & f, const Image & im )
+                            { VolWriter<Image>::exportVol( f, im, false ); },
+                            []( const std::string & f )
+                            { return VolReader<Image>::importVol( f ); } );
+    res = res && benchmark( "vol (compressed)", "benchVolIOz.vol", image,
+                            []( const std::string & f, const Image & im )
+                            { VolWriter<Image>::exportVol( f, im, true ); },
+                            []( const std::string & f )
+                            { return VolReader<Image>::importVol( f ); } );
+    res = res && benchmark( "pgm3d (binary)", "benchVolIO.pgm3d", image,
+                            []( const std::string & f, const Image & im )
+                            { PGMWriter<Image>::exportPGM3D( f, im ); },
+                            []( const std::string & f )
+                            { return PGMReader<Image>::importPGM3D( f ); } );
+  }
+  {
+    // longvol voxels are 8 times larger: keep the same payload size.
+    Domain ldomain( Point::zero, Point( side - 1, side - 1, std::max( 1, side / 8 ) - 1 ) );
+    LongImage image( ldomain );
+    DGtal::uint64_t i = 0;
+    for ( LongImage::Iterator it = image.begin(), itend = image.end(); it != itend; ++it, ++i )
+      *it = i;
+    res = res && benchmark( "longvol (raw)", "benchVolIO.longvol", image,
+                            []( const std::string & f, const LongImage & im )
+                            { LongvolWriter<LongImage>::exportLongvol( f, im, false ); },
+                            []( const std::string & f )
+                            { return LongvolReader<LongImage>::importLongvol( f ); } );
+  }
+
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
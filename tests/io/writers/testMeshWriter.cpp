@@ -29,12 +29,14 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <fstream>
 #include "DGtal/base/Common.h"
 #include "DGtal/helpers/StdDefs.h" 
 //! [MeshWriterUseIncludes]
 #include "DGtal/shapes/Mesh.h"
 #include "DGtal/io/writers/MeshWriter.h"
 //! [MeshWriterUseIncludes]
+#include "DGtal/io/readers/MeshReader.h"
 ///////////////////////////////////////////////////////////////////////////////
 
 using namespace std;
@@ -107,6 +109,85 @@ bool testMeshWriter()
   return nbok == nb;
 }
 
+/**
+ * Exports a colored mesh in binary PLY and STL formats and reads it
+ * back.
+ */
+bool testBinaryMeshWriter()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  typedef Mesh<RealPoint> RealMesh;
+  RealMesh aMesh(true);
+  aMesh.addVertex(RealPoint(0, 0, 0));
+  aMesh.addVertex(RealPoint(1, 0, 0));
+  aMesh.addVertex(RealPoint(1, 1, 0));
+  aMesh.addVertex(RealPoint(0, 1, 0));
+  aMesh.addVertex(RealPoint(0.5, 0.5, 1.5));
+  aMesh.addQuadFace(0, 3, 2, 1, DGtal::Color(250, 0, 0, 200));
+  aMesh.addTriangularFace(0, 1, 4, DGtal::Color(0, 250, 0));
+  aMesh.addTriangularFace(1, 2, 4, DGtal::Color(0, 0, 250));
+  aMesh.addTriangularFace(2, 3, 4, DGtal::Color::White);
+  aMesh.addTriangularFace(3, 0, 4, DGtal::Color::Black);
+
+  trace.beginBlock ( "Testing binary PLY and STL export/import ..." );
+  bool isOK = aMesh >> "testBinary.ply";
+  isOK = isOK && ( aMesh >> "testBinary.stl" );
+  nbok += isOK ? 1 : 0; nb++;
+
+  RealMesh plyMesh(true);
+  bool isOK2 = plyMesh << "testBinary.ply";
+  isOK2 = isOK2 && plyMesh.nbVertex() == aMesh.nbVertex()
+    && plyMesh.nbFaces() == aMesh.nbFaces();
+  for ( unsigned int i = 0; isOK2 && i < aMesh.nbFaces(); i++ )
+    isOK2 = RealMesh::MeshFace( plyMesh.getFace( i ) )
+      == RealMesh::MeshFace( aMesh.getFace( i ) )
+      && plyMesh.getFaceColor( i ) == aMesh.getFaceColor( i );
+  for ( unsigned int i = 0; isOK2 && i < aMesh.nbVertex(); i++ )
+    isOK2 = plyMesh.getVertex( i ) == aMesh.getVertex( i );
+  nbok += isOK2 ? 1 : 0; nb++;
+
+  // STL only stores triangles: the quad is cut in two.
+  RealMesh stlMesh;
+  bool isOK3 = stlMesh << "testBinary.stl";
+  isOK3 = isOK3 && stlMesh.nbVertex() == aMesh.nbVertex()
+    && stlMesh.nbFaces() == aMesh.nbFaces() + 1
+    && stlMesh.faces().isTriangular();
+  nbok += isOK3 ? 1 : 0; nb++;
+
+  // Face indices out of the vertex range are rejected.
+  for ( const std::string index : { "3", "-1" } )
+    {
+      std::ofstream bad( "testBadIndex.ply" );
+      bad << "ply\nformat ascii 1.0\nelement vertex 3\n"
+          << "property float x\nproperty float y\nproperty float z\n"
+          << "element face 1\nproperty list uchar int vertex_indices\nend_header\n"
+          << "0 0 0\n1 0 0\n0 1 0\n3 0 1 " << index << "\n";
+      bad.close();
+      RealMesh badMesh;
+      nbok += ( ! ( badMesh << "testBadIndex.ply" ) ) ? 1 : 0; nb++;
+    }
+
+  // Faces referring to missing vertices are rejected by the writers.
+  {
+    std::ofstream out( "testBadIndex.stl", std::ios::binary );
+    nbok += ( ! MeshWriter<RealPoint>::export2STL
+              ( out, aMesh.vertexBegin(), aMesh.vertexBegin() + 4,
+                aMesh.faces(), std::vector<RealPoint>() ) ) ? 1 : 0; nb++;
+    const std::vector<RealPoint> noNormals;
+    const std::vector<DGtal::Color> noColors;
+    nbok += ( ! MeshWriter<RealPoint>::export2PLY
+              ( out, aMesh.vertexBegin(), aMesh.vertexBegin() + 4, aMesh.faces(),
+                noNormals, noColors, noNormals, noColors ) ) ? 1 : 0; nb++;
+    nbok += ( out.tellp() == 0 ) ? 1 : 0; nb++;
+  }
+
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "ply and stl files read back" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -118,7 +199,7 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testMeshWriter(); // && ... other tests
+  bool res = testMeshWriter() && testBinaryMeshWriter(); // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
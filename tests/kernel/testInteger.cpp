@@ -51,6 +51,9 @@ bool testInteger()
   trace.beginBlock ( "Checking CInteger models ..." );
   BOOST_CONCEPT_ASSERT(( concepts::CInteger<int> ));
   BOOST_CONCEPT_ASSERT(( concepts::CInteger<DGtal::int16_t> ));
+#ifdef DGTAL_HAS_INT128
+  BOOST_CONCEPT_ASSERT(( concepts::CInteger<DGtal::int128_t> ));
+#endif
 
   trace.info() << "  - max int16 = " << NumberTraits<DGtal::int16_t>::max()
          << std::endl;
@@ -76,6 +79,12 @@ bool testInteger()
          << std::endl;
   trace.info() << "  - min uint64 = " << NumberTraits<DGtal::uint64_t>::min()
          << std::endl;
+#ifdef DGTAL_HAS_INT128
+  trace.info() << "  - max int128 = " << NumberTraits<DGtal::int128_t>::max()
+         << std::endl;
+  trace.info() << "  - min int128 = " << NumberTraits<DGtal::int128_t>::min()
+         << std::endl;
+#endif
 
   trace.endBlock();
 
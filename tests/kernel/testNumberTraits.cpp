@@ -25,6 +25,7 @@
  */
 
 #include <limits>
+#include <cmath>
 
 #include "DGtal/base/BasicTypes.h"
 #include "DGtal/kernel/NumberTraits.h"
@@ -165,6 +166,47 @@ TEST_FUNDAMENTAL_FLOAT_TYPE( float )
 TEST_FUNDAMENTAL_FLOAT_TYPE( double )
 TEST_FUNDAMENTAL_FLOAT_TYPE( long double )
 
+#ifdef DGTAL_HAS_INT128
+
+/// Check traits for 128-bit integers (even if the standard library does not know them).
+template <typename T>
+void checkInt128Type( bool isSigned )
+{
+  using NT = typename DGtal::NumberTraits<T>;
+
+  REQUIRE_SAME_VALUE( typename NT::IsBounded,     true );
+  REQUIRE( std::is_same< typename NT::IsSigned, typename ValueToTag<true>::type >::value == isSigned );
+  REQUIRE( std::is_same< typename NT::IsUnsigned, typename ValueToTag<true>::type >::value == ! isSigned );
+  REQUIRE_SAME_VALUE( typename NT::IsIntegral,    true );
+  REQUIRE_SAME_VALUE( typename NT::IsSpecialized, true );
+  REQUIRE_SAME_TYPE( typename NT::ReturnType, T );
+  REQUIRE_SAME_TYPE( typename std::decay<typename NT::ParamType>::type, T );
+  REQUIRE_SAME_TYPE( typename NT::SignedVersion, DGtal::int128_t );
+  REQUIRE_SAME_TYPE( typename NT::UnsignedVersion, DGtal::uint128_t );
+
+  REQUIRE( NT::zero() == T(0) );
+  REQUIRE( NT::one()  == T(1) );
+  REQUIRE( NT::digits() == ( isSigned ? 127u : 128u ) );
+  REQUIRE( NT::max() == T( ~ DGtal::uint128_t(0) >> ( isSigned ? 1 : 0 ) ) );
+  REQUIRE( NT::min() == ( isSigned ? T( - NT::max() - 1 ) : T(0) ) );
+  REQUIRE( NT::max() > T( std::numeric_limits<DGtal::uint64_t>::max() ) );
+  REQUIRE( NT::isBounded() == DGtal::BOUNDED );
+  REQUIRE( NT::isSigned() == ( isSigned ? DGtal::SIGNED : DGtal::UNSIGNED ) );
+
+  REQUIRE( NT::even(T(42)) == true );
+  REQUIRE( NT::odd(T(43)) == true );
+  REQUIRE( NT::castToInt64_t(T(3.25)) == 3 );
+  REQUIRE( NT::castToDouble(T(1) << 100) == std::ldexp( 1.0, 100 ) );
+
+  checkParamRef(NT::ZERO);
+  checkParamRef(NT::ONE);
+}
+
+TEST_CASE( "int128_t" )  { checkInt128Type<DGtal::int128_t>( true ); }
+TEST_CASE( "uint128_t" ) { checkInt128Type<DGtal::uint128_t>( false ); }
+
+#endif
+
 #ifdef WITH_BIGINTEGER
 
 /// Check traits for a BigInteger
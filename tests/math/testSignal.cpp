@@ -29,6 +29,8 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <cmath>
+#include <algorithm>
 #include "DGtal/base/Common.h"
 #include "DGtal/math/Signal.h"
 ///////////////////////////////////////////////////////////////////////////////
@@ -71,6 +73,45 @@ bool testSignal()
   return true;
 }
 
+/**
+ * Checks that convolveG2n (iterated G2 passes) gives the same result
+ * as the direct convolution by the binomial mask.
+ */
+bool testConvolveG2n()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing convolveG2n ..." );
+  double values[ 17 ];
+  for ( unsigned int i = 0; i < 17; ++i )
+    values[ i ] = (double) ( ( i * 37 ) % 11 ) - 3.5;
+  for ( int periodic = 0; periodic < 2; ++periodic )
+    {
+      Signal<double> signal( values, 17, 3, periodic == 1, 0.5 );
+      for ( unsigned int n = 1; n < 25; ++n )
+        {
+          // Reference: direct convolution with H2n / 4^n.
+          Signal<double> H = Signal<double>::H2n( n );
+          Signal<double> ref = signal * H;
+          ref.multiply( std::pow( 0.25, (double) n ) );
+          Signal<double> G = Signal<double>::G2n( n );
+          H.multiply( std::pow( 0.25, (double) n ) );
+          Signal<double> conv = signal.convolveG2n( n );
+          double error = 0.0;
+          // abscissae of the samples of the non periodic result.
+          for ( int i = -3 - (int) n; i <= 13 + (int) n; ++i )
+            error = std::max( error, std::fabs( conv[ i ] - ref[ i ] ) );
+          for ( int i = - (int) n - 1; i <= (int) n + 1; ++i )
+            error = std::max( error, std::fabs( G[ i ] - H[ i ] ) );
+          nbok += ( conv.size() == ref.size() && error < 1e-12 ) ? 1 : 0;
+          nb++;
+        }
+    }
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "convolveG2n( n ) == * G2n( n )" << endl;
+  trace.endBlock();
+  return nbok == nb;
+}
 
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
@@ -83,7 +124,7 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testSignal();
+  bool res = testSignal() && testConvolveG2n();
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
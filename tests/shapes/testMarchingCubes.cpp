@@ -0,0 +1,204 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testMarchingCubes.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing class MarchingCubes.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <algorithm>
+#include <array>
+#include <set>
+#include "DGtal/base/Common.h"
+#include "ConfigTest.h"
+#include "DGtalCatch.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/helpers/Shortcuts.h"
+#include "DGtal/images/ImageLinearCellEmbedder.h"
+#include "DGtal/kernel/RegularPointEmbedder.h"
+#include "DGtal/shapes/MeshHelpers.h"
+#include "DGtal/shapes/MarchingCubes.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class MarchingCubes.
+///////////////////////////////////////////////////////////////////////////////
+
+typedef Shortcuts<Z3i::KSpace>       SH3;
+typedef SH3::GrayScaleImage          GrayImage;
+typedef MarchingCubes<GrayImage>     MC;
+typedef MC::RealPoint                RealPoint;
+typedef std::array<double,3>         Position;
+
+/// The faces of a polygonal surface, as cycles of positions starting
+/// at their smallest position.
+template <typename TSurface>
+std::multiset< std::vector<Position> > orientedFaces( const TSurface & surf )
+{
+  std::multiset< std::vector<Position> > result;
+  for ( typename TSurface::Index f = 0; f < surf.nbFaces(); ++f )
+    {
+      std::vector<Position> face;
+      for ( auto v : surf.verticesAroundFace( f ) )
+        {
+          const RealPoint x = surf.position( v );
+          face.push_back( {{ x[ 0 ], x[ 1 ], x[ 2 ] }} );
+        }
+      std::rotate( face.begin(), std::min_element( face.begin(), face.end() ),
+                   face.end() );
+      result.insert( face );
+    }
+  return result;
+}
+
+TEST_CASE( "Testing MarchingCubes configurations" )
+{
+  MC mc;
+  SECTION("Every vertex of a cube belongs to exactly one face")
+    {
+      unsigned int nbok = 0;
+      for ( unsigned int config = 0; config < 256; ++config )
+        {
+          const MC::CubeConfiguration & cube = mc.configuration( config );
+          unsigned int nbActive = 0;
+          for ( unsigned int c = 0; c < 8; ++c )
+            for ( unsigned int a = 0; a < 3; ++a )
+              if ( ! ( c & ( 1u << a ) ) )
+                nbActive += ( ( config >> c ) & 1 ) != ( ( config >> ( c | ( 1u << a ) ) ) & 1 );
+          unsigned int nbVertices = 0;
+          for ( unsigned int f = 0; f < cube.nbFaces; ++f )
+            nbVertices += cube.sizes[ f ];
+          std::set<unsigned int> edges( cube.edges, cube.edges + nbVertices );
+          nbok += ( nbVertices == nbActive && edges.size() == nbActive ) ? 1 : 0;
+        }
+      REQUIRE( nbok == 256 );
+    }
+  SECTION("A single inside voxel is cut by a triangle")
+    {
+      const MC::CubeConfiguration & cube = mc.configuration( 1 );
+      REQUIRE( cube.nbFaces == 1 );
+      REQUIRE( cube.sizes[ 0 ] == 3 );
+    }
+  SECTION("Ambiguous faces depend on the surfel adjacency")
+    {
+      // Two inside voxels on a diagonal of the face z=0.
+      GrayImage image( Z3i::Domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 1, 1, 1 ) ) );
+      image.setValue( Z3i::Point( 0, 0, 0 ), 255 );
+      image.setValue( Z3i::Point( 1, 1, 0 ), 255 );
+      mc.init( image, 0, 255, 0.5, false );
+      REQUIRE( mc.configuration( 9 ).nbFaces == 1 );
+      mc.init( image, 0, 255, 0.5, true );
+      REQUIRE( mc.configuration( 9 ).nbFaces == 2 );
+    }
+}
+
+TEST_CASE( "Testing MarchingCubes extraction" )
+{
+  Z3i::Domain domain( Z3i::Point( -8, -7, -9 ), Z3i::Point( 9, 8, 7 ) );
+  CountedPtr<GrayImage> image( new GrayImage( domain ) );
+  srand( 0 );
+  for ( auto p : domain )
+    {
+      const double d = ( p - Z3i::Point( 1, 0, -1 ) ).norm();
+      image->setValue( p, (unsigned char)
+                       std::max( 0.0, std::min( 255.0, 200.0 - 25.0 * d + rand() % 10 ) ) );
+    }
+  const RealPoint center( 1.0, 0.0, -1.0 );
+
+  SECTION("Same surface as the dual surface of the digital surface")
+    {
+      for ( int adj = 0; adj < 2; ++adj )
+        {
+          auto params = SH3::defaultParameters();
+          params( "surfelAdjacency", adj )( "thresholdMin", 40 );
+          auto K       = SH3::getKSpace( image );
+          auto digsurf = SH3::makeDigitalSurface
+            ( SH3::makeBinaryImage( image, params ), K, params );
+          RegularPointEmbedder<Z3i::Space> pembedder;
+          pembedder.init( RealPoint::diagonal( 1.0 ) );
+          ImageLinearCellEmbedder< Z3i::KSpace, GrayImage,
+                                   RegularPointEmbedder<Z3i::Space> > cembedder;
+          cembedder.init( K, *image, pembedder, 40.5 );
+          PolygonalSurface<RealPoint> polysurf;
+          SH3::Surfel2Index s2i;
+          MeshHelpers::digitalSurface2DualPolygonalSurface
+            ( *digsurf, cembedder, polysurf, s2i );
+
+          MC mc;
+          mc.init( *image, 40, 255, 40.5, adj == 1 );
+          mc.compute();
+          PolygonalSurface<RealPoint> polysurf2;
+          REQUIRE( mc.getPolygonalSurface( polysurf2 ) );
+          REQUIRE( polysurf2.nbVertices() == digsurf->size() );
+          REQUIRE( polysurf2.nbFaces() == digsurf->allClosedFaces().size() );
+          REQUIRE( orientedFaces( polysurf2 ) == orientedFaces( polysurf ) );
+        }
+    }
+
+  SECTION("The output does not depend on the number of chunks")
+    {
+      MC mc1, mc2;
+      mc1.init( *image, 40, 255, 40.5 );
+      mc2.init( *image, 40, 255, 40.5 );
+      mc1.compute( 1 );
+      mc2.compute( 7 );
+      REQUIRE( mc1.nbFaces() > 0 );
+      REQUIRE( mc1.vertices() == mc2.vertices() );
+      REQUIRE( mc1.faceOffsets() == mc2.faceOffsets() );
+      REQUIRE( mc1.faceVertices() == mc2.faceVertices() );
+    }
+
+  SECTION("Closed triangulated surface with inward normals")
+    {
+      MC mc;
+      mc.init( *image, 40, 255, 40.5 );
+      mc.compute();
+      TriangulatedSurface<RealPoint> trisurf;
+      REQUIRE( mc.getTriangulatedSurface( trisurf ) );
+      REQUIRE( trisurf.allBoundaryArcs().empty() );
+      REQUIRE( trisurf.Euler() % 2 == 0 );
+      unsigned int nbok = 0;
+      for ( TriangulatedSurface<RealPoint>::Face f = 0; f < trisurf.nbFaces(); ++f )
+        {
+          auto v = trisurf.verticesAroundFace( f );
+          const RealPoint x0 = trisurf.position( v[ 0 ] );
+          const RealPoint n  = ( trisurf.position( v[ 1 ] ) - x0 )
+            .crossProduct( trisurf.position( v[ 2 ] ) - x0 );
+          nbok += n.dot( x0 - center ) < 0.0 ? 1 : 0;
+        }
+      REQUIRE( nbok == trisurf.nbFaces() );
+
+      Mesh<RealPoint> mesh;
+      mc.getMesh( mesh );
+      REQUIRE( mesh.nbVertex() == mc.nbVertices() );
+      REQUIRE( mesh.nbFaces() == mc.nbFaces() );
+    }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,146 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testMeshFaceStorage.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing class MeshFaceStorage and its use by Mesh.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtalCatch.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/shapes/MeshFaceStorage.h"
+#include "DGtal/shapes/Mesh.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class MeshFaceStorage.
+///////////////////////////////////////////////////////////////////////////////
+
+typedef MeshFaceStorage::Face Face;
+
+SCENARIO( "MeshFaceStorage triangle fast path and mixed faces", "[mesh][storage]" )
+{
+  MeshFaceStorage faces;
+  faces.pushTriangle( 0, 1, 2 );
+  faces.pushTriangle( 2, 1, 3 );
+  GIVEN( "Only triangles" ) {
+    THEN( "The offsets are implicit" ) {
+      REQUIRE( faces.size() == 2 );
+      REQUIRE( faces.nbIndices() == 6 );
+      REQUIRE( faces.isTriangular() );
+      REQUIRE( faces.isValid() );
+      REQUIRE( faces.faceSize( 1 ) == 3 );
+      REQUIRE( Face( faces[ 1 ] ) == Face( { 2, 1, 3 } ) );
+    }
+  }
+  GIVEN( "A quadrangle added after triangles" ) {
+    const unsigned int quad[] = { 0, 1, 3, 2 };
+    faces.push_back( quad, quad + 4 );
+    faces.pushTriangle( 4, 5, 6 );
+    THEN( "The offsets are made explicit and faces are unchanged" ) {
+      REQUIRE( faces.size() == 4 );
+      REQUIRE( ! faces.isTriangular() );
+      REQUIRE( faces.isValid() );
+      REQUIRE( faces.offset( 2 ) == 6 );
+      REQUIRE( faces.offset( 3 ) == 10 );
+      REQUIRE( Face( faces[ 0 ] ) == Face( { 0, 1, 2 } ) );
+      REQUIRE( Face( faces[ 2 ] ) == Face( { 0, 1, 3, 2 } ) );
+      REQUIRE( Face( faces[ 3 ] ) == Face( { 4, 5, 6 } ) );
+      REQUIRE_THROWS_AS( faces.at( 4 ), std::out_of_range );
+    }
+    THEN( "Iterating over faces visits every view" ) {
+      unsigned int nb = 0;
+      MeshFaceStorage::Size sum = 0;
+      for ( auto it = faces.begin(), itE = faces.end(); it != itE; ++it, ++nb )
+        sum += it->size();
+      REQUIRE( nb == 4 );
+      REQUIRE( sum == faces.nbIndices() );
+      REQUIRE( faces.end() - faces.begin() == 4 );
+    }
+  }
+  GIVEN( "Bulk appended faces" ) {
+    std::vector<unsigned int> soup = { 0, 1, 2, 3, 4, 5, 6, 7, 8 };
+    auto nb = faces.append( soup.begin(), soup.end(), 3 );
+    THEN( "Triangles keep the fast path" ) {
+      REQUIRE( nb == 3 );
+      REQUIRE( faces.size() == 5 );
+      REQUIRE( faces.isTriangular() );
+      REQUIRE( Face( faces[ 4 ] ) == Face( { 6, 7, 8 } ) );
+    }
+    THEN( "Quadrangles switch to explicit offsets" ) {
+      auto nbq = faces.append( soup.begin(), soup.begin() + 8, 4 );
+      REQUIRE( nbq == 2 );
+      REQUIRE( faces.size() == 7 );
+      REQUIRE( faces.isValid() );
+      REQUIRE( Face( faces[ 4 ] ) == Face( { 6, 7, 8 } ) );
+      REQUIRE( Face( faces[ 6 ] ) == Face( { 4, 5, 6, 7 } ) );
+    }
+  }
+}
+
+SCENARIO( "Mesh with compressed face storage", "[mesh][storage]" )
+{
+  typedef Mesh<Z3i::RealPoint> RealMesh;
+  RealMesh aMesh( true );
+  aMesh.addVertex( Z3i::RealPoint( 0, 0, 0 ) );
+  aMesh.addVertex( Z3i::RealPoint( 1, 0, 0 ) );
+  aMesh.addVertex( Z3i::RealPoint( 1, 1, 0 ) );
+  aMesh.addVertex( Z3i::RealPoint( 0, 1, 0 ) );
+  aMesh.addVertex( Z3i::RealPoint( 0, 0, 1 ) );
+  std::vector<unsigned int> tris = { 0, 1, 4, 1, 2, 4, 2, 3, 4 };
+  auto nb = aMesh.addFaces( tris.begin(), tris.end(), 3, Color::Red );
+  aMesh.addQuadFace( 0, 3, 2, 1, Color::Blue );
+  THEN( "Faces and colors are consistent" ) {
+    REQUIRE( nb == 3 );
+    REQUIRE( aMesh.nbFaces() == 4 );
+    REQUIRE( aMesh.getFaceColor( 2 ) == Color::Red );
+    REQUIRE( aMesh.getFaceColor( 3 ) == Color::Blue );
+    REQUIRE( aMesh.getFace( 3 ).size() == 4 );
+    RealMesh::MeshFace face = aMesh.getFace( 1 );
+    REQUIRE( face == RealMesh::MeshFace( { 1, 2, 4 } ) );
+  }
+  THEN( "Faces can be modified in place" ) {
+    aMesh.invertVertexFaceOrder();
+    REQUIRE( RealMesh::MeshFace( aMesh.getFace( 3 ) )
+             == RealMesh::MeshFace( { 1, 2, 3, 0 } ) );
+    aMesh.quadToTriangularFaces();
+    REQUIRE( aMesh.nbFaces() == 5 );
+    REQUIRE( aMesh.faces().isTriangular() );
+  }
+  THEN( "Removing faces keeps the others" ) {
+    aMesh.removeFaces( { 0 } );
+    REQUIRE( aMesh.nbFaces() == 3 );
+    REQUIRE( aMesh.faces().isValid() );
+    REQUIRE( aMesh.getFace( 2 ).size() == 4 );
+  }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,151 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testShapesDigitization.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing the slab-parallel digitization services of
+ * class Shapes (digitalShaper, imageShaper).
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include "DGtal/base/Common.h"
+#include "ConfigTest.h"
+#include "DGtalCatch.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/shapes/Shapes.h"
+#include "DGtal/shapes/GaussDigitizer.h"
+#include "DGtal/shapes/parametric/Flower2D.h"
+#include "DGtal/shapes/implicit/ImplicitBall.h"
+#include "DGtal/shapes/implicit/ImplicitPolynomial3Shape.h"
+#include "DGtal/io/readers/MPolynomialReader.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+/// Counts the points of the digitizer domain where the sequential
+/// evaluation of the orientation differs from the given image.
+template <typename TImage, typename TDigitizer>
+unsigned int countErrors( const TImage & image, const TDigitizer & dig )
+{
+  unsigned int nb = 0;
+  for ( auto p : image.domain() )
+    {
+      const Orientation o = dig.orientation( p );
+      const bool in = ( o == INSIDE || o == ON );
+      if ( in != (bool) image( p ) ) ++nb;
+    }
+  return nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class Shapes.
+///////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE( "Testing 2D slab-parallel digitization" )
+{
+  typedef Flower2D<Z2i::Space> Flower;
+  typedef GaussDigitizer<Z2i::Space, Flower> Digitizer;
+  Flower flower( 0.5, -0.3, 15.0, 5.0, 5, 0.3 );
+  Digitizer dig;
+  dig.attach( flower );
+  dig.init( flower.getLowerBound(), flower.getUpperBound(), 0.25 );
+  const Z2i::Domain domain = dig.getDomain();
+
+  SECTION("digitalShaper gives the sequential set")
+  {
+    Z2i::DigitalSet set( domain );
+    Shapes<Z2i::Domain>::digitalShaper( set, dig );
+    unsigned int nbok = 0;
+    for ( auto p : domain )
+      {
+        const Orientation o = dig.orientation( p );
+        nbok += ( ( o == INSIDE || o == ON ) == set( p ) ) ? 1 : 0;
+      }
+    REQUIRE( set.size() > 0 );
+    REQUIRE( nbok == domain.size() );
+  }
+
+  SECTION("imageShaper fills a boolean image")
+  {
+    ImageContainerBySTLVector<Z2i::Domain, bool> image( domain );
+    Shapes<Z2i::Domain>::imageShaper( image, dig, true, false );
+    REQUIRE( countErrors( image, dig ) == 0 );
+  }
+}
+
+TEST_CASE( "Testing 3D slab-parallel digitization" )
+{
+  typedef Z3i::Space::RealPoint RealPoint;
+
+  SECTION("Ball digitized in a grey-level image with custom values")
+  {
+    typedef ImplicitBall<Z3i::Space> Ball;
+    typedef GaussDigitizer<Z3i::Space, Ball> Digitizer;
+    Ball ball( RealPoint( 0.3, -0.2, 0.1 ), 7.5 );
+    Digitizer dig;
+    dig.attach( ball );
+    dig.init( ball.getLowerBound(), ball.getUpperBound(), 0.5 );
+    ImageContainerBySTLVector<Z3i::Domain, unsigned char> image( dig.getDomain() );
+    Shapes<Z3i::Domain>::imageShaper( image, dig, 200, 10 );
+    unsigned int nbok = 0, nbin = 0;
+    for ( auto p : image.domain() )
+      {
+        const Orientation o = dig.orientation( p );
+        const bool in = ( o == INSIDE || o == ON );
+        nbin += in ? 1 : 0;
+        nbok += ( image( p ) == ( in ? 200 : 10 ) ) ? 1 : 0;
+      }
+    REQUIRE( nbin > 0 );
+    REQUIRE( nbok == image.domain().size() );
+  }
+
+  SECTION("Polynomial surface, set and image agree")
+  {
+    typedef MPolynomial<3, double> Polynomial3;
+    typedef ImplicitPolynomial3Shape<Z3i::Space> Shape;
+    typedef GaussDigitizer<Z3i::Space, Shape> Digitizer;
+    Polynomial3 P;
+    MPolynomialReader<3, double> reader;
+    std::string poly = "x^2+y^2+2*z^2-x*y*z+z^3-100";
+    REQUIRE( reader.read( P, poly.begin(), poly.end() ) == poly.end() );
+    Shape shape( P );
+    Digitizer dig;
+    dig.attach( shape );
+    dig.init( RealPoint( -12, -12, -12 ), RealPoint( 12, 12, 12 ), 0.5 );
+    const Z3i::Domain domain = dig.getDomain();
+    ImageContainerBySTLVector<Z3i::Domain, bool> image( domain );
+    Shapes<Z3i::Domain>::imageShaper( image, dig );
+    REQUIRE( countErrors( image, dig ) == 0 );
+    Z3i::DigitalSet set( domain );
+    Shapes<Z3i::Domain>::digitalShaper( set, dig );
+    unsigned int nbin = 0;
+    for ( auto p : domain ) nbin += image( p ) ? 1 : 0;
+    REQUIRE( set.size() == nbin );
+  }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
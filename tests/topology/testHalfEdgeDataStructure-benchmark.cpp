@@ -0,0 +1,102 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testHalfEdgeDataStructure-benchmark.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/19
+ *
+ * Builds the half-edge data structure of a triangulated torus, by
+ * sorting arcs (HalfEdgeDataStructure::build( triangles )) versus
+ * with maps (getUnorderedEdgesFromTriangles then build( num_vertices,
+ * triangles, edges )). The number of triangles (default 1M) may be
+ * given as first argument. A second argument equal to 0 skips the
+ * map-based build (e.g. for 20M triangles).
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include <cmath>
+#include "DGtal/base/Common.h"
+#include "DGtal/topology/HalfEdgeDataStructure.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef HalfEdgeDataStructure::Triangle Triangle;
+typedef HalfEdgeDataStructure::Edge     Edge;
+typedef HalfEdgeDataStructure::Size     Size;
+
+/// Triangulates a torus made of m x n squares (2mn triangles).
+std::vector< Triangle > makeTorus( Size m, Size n )
+{
+  std::vector< Triangle > triangles;
+  triangles.reserve( 2 * m * n );
+  for ( Size j = 0; j < n; ++j )
+    for ( Size i = 0; i < m; ++i )
+      {
+        const Size v00 = j * m + i;
+        const Size v10 = j * m + ( i+1 ) % m;
+        const Size v01 = ( ( j+1 ) % n ) * m + i;
+        const Size v11 = ( ( j+1 ) % n ) * m + ( i+1 ) % m;
+        triangles.push_back( Triangle( v00, v10, v11 ) );
+        triangles.push_back( Triangle( v00, v11, v01 ) );
+      }
+  return triangles;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  const Size nb_triangles = ( argc > 1 ) ? atol( argv[ 1 ] ) : 1000000;
+  const bool with_maps    = ( argc > 2 ) ? atoi( argv[ 2 ] ) != 0 : true;
+  const Size m = std::max( Size( 3 ), Size( std::sqrt( nb_triangles / 2.0 ) ) );
+  const Size n = std::max( Size( 3 ), nb_triangles / ( 2 * m ) );
+  trace.beginBlock ( "Benchmarking HalfEdgeDataStructure builds" );
+  std::vector< Triangle > triangles = makeTorus( m, n );
+  trace.info() << "Torus " << m << "x" << n << ", "
+               << triangles.size() << " triangles" << std::endl;
+
+  trace.beginBlock( "Build by sorting arcs" );
+  HalfEdgeDataStructure sorted;
+  bool ok = sorted.build( triangles );
+  trace.info() << sorted << std::endl;
+  trace.endBlock();
+
+  if ( with_maps )
+    {
+      trace.beginBlock( "Build with maps" );
+      std::vector< Edge > edges;
+      const Size nbV
+        = HalfEdgeDataStructure::getUnorderedEdgesFromTriangles( triangles, edges );
+      HalfEdgeDataStructure mapped;
+      ok = mapped.build( nbV, triangles, edges ) && ok;
+      trace.info() << mapped << std::endl;
+      trace.endBlock();
+    }
+  trace.endBlock();
+  return ok ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -638,4 +638,118 @@ SCENARIO( "HalfEdgeDataStructure merges", "[halfedge][merges]" ){
   }
 }
 
+/// Builds the given triangles with maps, i.e. by computing their
+/// edges then calling build( num_vertices, triangles, edges ).
+HalfEdgeDataStructure buildWithEdges( const std::vector< Triangle >& triangles )
+{
+  std::vector< Edge > edges;
+  const auto kNumVertices
+    = HalfEdgeDataStructure::getUnorderedEdgesFromTriangles( triangles, edges );
+  HalfEdgeDataStructure mesh;
+  mesh.build( kNumVertices, triangles, edges );
+  return mesh;
+}
+
+/// Builds the given polygonal faces with maps, i.e. by computing
+/// their edges then calling build( num_vertices, faces, edges ).
+HalfEdgeDataStructure buildWithEdges( const std::vector< PolygonalFace >& faces )
+{
+  std::vector< Edge > edges;
+  const auto kNumVertices
+    = HalfEdgeDataStructure::getUnorderedEdgesFromPolygonalFaces( faces, edges );
+  HalfEdgeDataStructure mesh;
+  mesh.build( kNumVertices, faces, edges );
+  return mesh;
+}
+
+/// @return 'true' iff both structures have the same half-edges,
+/// numbered in the same way, and the same arcs.
+bool haveSameLayout( const HalfEdgeDataStructure& m1,
+                     const HalfEdgeDataStructure& m2 )
+{
+  if ( m1.nbHalfEdges() != m2.nbHalfEdges() || m1.nbVertices() != m2.nbVertices()
+       || m1.nbEdges() != m2.nbEdges() || m1.nbFaces() != m2.nbFaces() )
+    return false;
+  for ( Size i = 0; i < m1.nbHalfEdges(); ++i )
+    {
+      const auto& he1 = m1.halfEdge( i );
+      const auto& he2 = m2.halfEdge( i );
+      if ( he1.toVertex != he2.toVertex || he1.face != he2.face || he1.edge != he2.edge
+           || he1.opposite != he2.opposite || he1.next != he2.next )
+        return false;
+      const ArcT arc = m1.arcFromHalfEdgeIndex( i );
+      if ( m1.halfEdgeIndexFromArc( arc ) != i || m2.halfEdgeIndexFromArc( arc ) != i )
+        return false;
+    }
+  for ( Size v = 0; v < m1.nbVertices(); ++v )
+    if ( m1.halfEdgeIndexFromVertexIndex( v ) != m2.halfEdgeIndexFromVertexIndex( v ) )
+      return false;
+  for ( Size e = 0; e < m1.nbEdges(); ++e )
+    if ( m1.halfEdgeIndexFromEdgeIndex( e ) != m2.halfEdgeIndexFromEdgeIndex( e ) )
+      return false;
+  for ( Size f = 0; f < m1.nbFaces(); ++f )
+    if ( m1.halfEdgeIndexFromFaceIndex( f ) != m2.halfEdgeIndexFromFaceIndex( f ) )
+      return false;
+  return true;
+}
+
+SCENARIO( "HalfEdgeDataStructure build by sorting arcs", "[halfedge][build]" ){
+  GIVEN( "Triangles of a ribbon with a hole" ) {
+    std::vector< Triangle > triangles( 6 );
+    triangles[0].v = { 0, 1, 2 };
+    triangles[1].v = { 2, 1, 3 };
+    triangles[2].v = { 2, 3, 4 };
+    triangles[3].v = { 4, 3, 5 };
+    triangles[4].v = { 4, 5, 0 };
+    triangles[5].v = { 0, 5, 1 };
+    HalfEdgeDataStructure mesh;
+    REQUIRE( mesh.build( triangles ) );
+    THEN( "It has the same layout as the map-based build" ) {
+      REQUIRE( mesh.isValid() );
+      REQUIRE( haveSameLayout( mesh, buildWithEdges( triangles ) ) );
+    }
+  }
+  GIVEN( "A box with an open side" ) {
+    HalfEdgeDataStructure mesh = makeBox();
+    std::vector< PolygonalFace > faces( 6 );
+    faces[ 0 ] = PolygonalFace( { 1, 0, 2, 3 } );
+    faces[ 1 ] = PolygonalFace( { 0, 1, 5, 4 } );
+    faces[ 2 ] = PolygonalFace( { 1, 3, 7, 5 } );
+    faces[ 3 ] = PolygonalFace( { 3, 2, 6, 7 } );
+    faces[ 4 ] = PolygonalFace( { 2, 0, 4, 6 } );
+    faces[ 5 ] = PolygonalFace( { 4, 5, 8, 9 } );
+    THEN( "It has the same layout as the map-based build" ) {
+      REQUIRE( haveSameLayout( mesh, buildWithEdges( faces ) ) );
+    }
+  }
+  GIVEN( "A triangulated grid with holes" ) {
+    const unsigned int n = 20;
+    std::vector< Triangle > triangles;
+    for ( unsigned int y = 0; y < n; ++y )
+      for ( unsigned int x = 0; x < n; ++x )
+        {
+          if ( ( x % 5 == 2 ) && ( y % 5 == 2 ) ) continue;
+          const unsigned int v = y * ( n+1 ) + x;
+          triangles.push_back( Triangle( v, v+1, v+n+2 ) );
+          triangles.push_back( Triangle( v, v+n+2, v+n+1 ) );
+        }
+    HalfEdgeDataStructure mesh;
+    REQUIRE( mesh.build( triangles ) );
+    THEN( "It has the same layout as the map-based build" ) {
+      REQUIRE( mesh.isValid() );
+      REQUIRE( mesh.nbFaces() == triangles.size() );
+      REQUIRE( haveSameLayout( mesh, buildWithEdges( triangles ) ) );
+    }
+  }
+  GIVEN( "Two triangles sharing an arc" ) {
+    std::vector< Triangle > triangles( 2 );
+    triangles[0].v = { 0, 1, 2 };
+    triangles[1].v = { 0, 1, 3 };
+    HalfEdgeDataStructure mesh;
+    THEN( "The build fails" ) {
+      REQUIRE( ! mesh.build( triangles ) );
+    }
+  }
+}
+
 /** @ingroup Tests **/
@@ -40,6 +40,7 @@
 #include "DGtal/topology/DigitalSetBoundary.h"
 #include "DGtal/topology/IndexedDigitalSurface.h"
 #include "DGtal/shapes/Shapes.h"
+#include "DGtal/helpers/Shortcuts.h"
 ///////////////////////////////////////////////////////////////////////////////
 
 using namespace std;
@@ -110,6 +111,81 @@ SCENARIO( "IndexedDigitalSurface< DigitalSetBoundary > build tests", "[idxdsurf]
   }
 }
 
+SCENARIO( "IndexedDigitalSurface< DigitalSetBoundary > parallel build tests", "[idxdsurf][build][parallel]" )
+{
+  typedef DigitalSetBoundary< KSpace, DigitalSet > DigitalSurfaceContainer;
+  typedef IndexedDigitalSurface< DigitalSurfaceContainer > DigSurface;
+  Point p1( -10, -10, -10 );
+  Point p2(  10,  10,  10 );
+  KSpace K;
+  K.init( p1, p2, true );
+  DigitalSet aSet( Domain( p1, p2 ) );
+  Shapes<Domain>::addNorm2Ball( aSet, Point( 0, 0, 0 ), 7 );
+  Shapes<Domain>::removeNorm2Ball( aSet, Point( 0, 0, 0 ), 3 );
+  CountedPtr< DigitalSurfaceContainer > container( new DigitalSurfaceContainer( K, aSet ) );
+  DigSurface dsurf, psurf;
+  bool build_ok  = dsurf.build( container );
+  bool pbuild_ok = psurf.buildInParallel( container );
+  GIVEN( "A digital set boundary over a hollow ball" ) {
+    THEN( "Serial and parallel builds give the same combinatorics" ) {
+      REQUIRE( build_ok  == true );
+      REQUIRE( pbuild_ok == true );
+      REQUIRE( psurf.nbVertices() == dsurf.nbVertices() );
+      REQUIRE( psurf.nbEdges()    == dsurf.nbEdges() );
+      REQUIRE( psurf.nbFaces()    == dsurf.nbFaces() );
+      REQUIRE( psurf.Euler()      == 4 );
+    }
+    THEN( "Vertices are numbered in increasing order of surfels" ) {
+      for ( DigSurface::Vertex v = 1; v < psurf.nbVertices(); ++v )
+        REQUIRE( psurf.surfel( v - 1 ) < psurf.surfel( v ) );
+    }
+    THEN( "Cells and indices are consistent with the serial build" ) {
+      unsigned int nb_ok = 0;
+      for ( DigSurface::Vertex v = 0; v < psurf.nbVertices(); ++v )
+        {
+          const auto w = dsurf.getVertex( psurf.surfel( v ) );
+          nb_ok += ( psurf.getVertex( psurf.surfel( v ) ) == v )
+            && ( psurf.position( v ) == dsurf.position( w ) )
+            && ( psurf.degree( v ) == dsurf.degree( w ) ) ? 1 : 0;
+        }
+      REQUIRE( nb_ok == psurf.nbVertices() );
+      nb_ok = 0;
+      for ( DigSurface::Arc a = 0; a < psurf.nbArcs(); ++a )
+        {
+          const auto b = dsurf.getArc( psurf.linel( a ) );
+          nb_ok += ( psurf.getArc( psurf.linel( a ) ) == a )
+            && ( psurf.surfel( psurf.tail( a ) ) == dsurf.surfel( dsurf.tail( b ) ) )
+            && ( psurf.surfel( psurf.head( a ) ) == dsurf.surfel( dsurf.head( b ) ) ) ? 1 : 0;
+        }
+      REQUIRE( nb_ok == psurf.nbArcs() );
+      nb_ok = 0;
+      for ( DigSurface::Face f = 0; f < psurf.nbFaces(); ++f )
+        {
+          const auto g = dsurf.getFace( psurf.pointel( f ) );
+          auto pvtcs = psurf.verticesAroundFace( f );
+          auto dvtcs = dsurf.verticesAroundFace( g );
+          std::set< SCell > psurfels, dsurfels;
+          for ( auto v : pvtcs ) psurfels.insert( psurf.surfel( v ) );
+          for ( auto v : dvtcs ) dsurfels.insert( dsurf.surfel( v ) );
+          nb_ok += ( psurf.getFace( psurf.pointel( f ) ) == f )
+            && ( psurfels == dsurfels ) ? 1 : 0;
+        }
+      REQUIRE( nb_ok == psurf.nbFaces() );
+    }
+    THEN( "Positions round-trip through the structure-of-arrays layout" ) {
+      typedef Shortcuts< KSpace > SH3;
+      SH3::RealVectors positions;
+      for ( DigSurface::Vertex v = 0; v < psurf.nbVertices(); ++v )
+        positions.push_back( psurf.position( v ) );
+      const SH3::RealVectorsSoA soa = SH3::getRealVectorsSoA( positions );
+      for ( Dimension k = 0; k < 3; ++k )
+        REQUIRE( soa[ k ].size() == positions.size() );
+      REQUIRE( soa[ 2 ][ 5 ] == positions[ 5 ][ 2 ] );
+      REQUIRE( SH3::getRealVectors( soa ) == positions );
+    }
+  }
+}
+
 SCENARIO( "IndexedDigitalSurface< RealPoint3 > concept check tests", "[idxdsurf][concepts]" )
 {
   typedef DigitalSetBoundary< KSpace, DigitalSet > DigitalSurfaceContainer;